@@ -29,7 +29,7 @@ gpioHandleKSDK_t D10 = {.base = GPIO1, .pinNumber = 3, .mask = 1 << (3), .clockN
 gpioHandleKSDK_t D2 = {.base = GPIO2, .pinNumber = 5, .mask = 1 << (5), .clockName = kCLOCK_GateGPIO2, .portNumber = 2};
 
 //GPIO Pin Handles
-gpioHandleKSDK_t ALERT_LED = {.base = GPIO3, .pinNumber = 15, .mask = 1 << (15), .clockName = kCLOCK_GateGPIO3, .portNumber = 3};
+gpioHandleKSDK_t ALERT_LED = GPIO_PIN_HANDLE_INIT(ALERT);
 
 // LPCXpresso55s69 Internal Peripheral Pin Definitions
 gpioHandleKSDK_t RED_LED = {
@@ -35,6 +35,15 @@ extern gpioHandleKSDK_t D1;
 extern gpioHandleKSDK_t D2;
 extern gpioHandleKSDK_t ALERT_LED;
 
+// ALERT: Pin descriptor of the sensor ALERT output, ALERT_LED is initialized from it
+#define ALERT_GPIO        GPIO3
+#define ALERT_PIN         15U
+#define ALERT_IRQ         GPIO3_IRQn
+#define ALERT_IRQ_HANDLER GPIO3_IRQHandler
+#define ALERT_CLOCK       kCLOCK_GateGPIO3
+#define ALERT_PORT_NUMBER PORTD_NUM
+GPIO_PIN_DEFINE_ACCESSORS(ALERT)
+
 // LPCXpresso54114 Internal Peripheral Pin Definitions
 extern gpioHandleKSDK_t RED_LED;
 extern gpioHandleKSDK_t GREEN_LED;
@@ -1386,7 +1386,9 @@ static void LPI2C_TransferStateMachineWaitState(LPI2C_Type *base,
  * @retval #kStatus_LPI2C_Nak
  * @retval #kStatus_LPI2C_FifoError
  */
-static status_t LPI2C_RunTransferStateMachine(LPI2C_Type *base, lpi2c_master_handle_t *handle, bool *isDone)
+LPI2C_RAMFUNC static status_t LPI2C_RunTransferStateMachine(LPI2C_Type *base,
+                                                            lpi2c_master_handle_t *handle,
+                                                            bool *isDone)
 {
     assert(NULL != base && NULL != handle && NULL != isDone);
 
@@ -1707,7 +1709,7 @@ void LPI2C_MasterTransferAbort(LPI2C_Type *base, lpi2c_master_handle_t *handle)
  * param lpi2cMasterHandle Pointer to the LPI2C master driver handle.
  */
 
-void LPI2C_MasterTransferHandleIRQ(LPI2C_Type *base, void *lpi2cMasterHandle)
+LPI2C_RAMFUNC void LPI2C_MasterTransferHandleIRQ(LPI2C_Type *base, void *lpi2cMasterHandle)
 {
     assert(lpi2cMasterHandle != NULL);
 
@@ -2495,7 +2497,7 @@ void LPI2C_SlaveTransferHandleIRQ(LPI2C_Type *base, lpi2c_slave_handle_t *handle
  * @param base The LPI2C peripheral base address.
  * @param instance The LPI2C peripheral instance number.
  */
-static void LPI2C_CommonIRQHandler(LPI2C_Type *base, uint32_t instance)
+LPI2C_RAMFUNC static void LPI2C_CommonIRQHandler(LPI2C_Type *base, uint32_t instance)
 {
     /* Check for master IRQ. */
     if ((0U != (base->MCR & LPI2C_MCR_MEN_MASK)) && (NULL != s_lpi2cMasterIsr))
@@ -2517,7 +2519,7 @@ static void LPI2C_CommonIRQHandler(LPI2C_Type *base, uint32_t instance)
 #if defined(LPI2C0)
 /* Implementation of LPI2C0 handler named in startup code. */
 void LPI2C0_DriverIRQHandler(void);
-void LPI2C0_DriverIRQHandler(void)
+LPI2C_RAMFUNC void LPI2C0_DriverIRQHandler(void)
 {
     LPI2C_CommonIRQHandler(LPI2C0, 0U);
 }
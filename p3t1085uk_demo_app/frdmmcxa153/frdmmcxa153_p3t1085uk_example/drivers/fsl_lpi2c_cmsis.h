@@ -63,6 +63,14 @@ extern ARM_DRIVER_I2C Driver_I2C5;
 extern ARM_DRIVER_I2C Driver_I2C6;
 #endif /* LPI2C6 */
 
+/* Vendor control code of the LPI2C driver, the 1 to 3 byte subaddress (register offset) in arg is sent
+ * from the LPI2C command FIFO ahead of the data of the next MasterTransmit, in the same transfer. */
+#define ARM_I2C_SUBADDRESS               (0x80UL)
+#define ARM_I2C_SUBADDRESS_MASK          (0x00FFFFFFUL)
+#define ARM_I2C_SUBADDRESS_SIZE_SHIFT    (24U)
+#define ARM_I2C_SUBADDRESS_ARG(sub, size) \
+    (((uint32_t)(sub) & ARM_I2C_SUBADDRESS_MASK) | ((uint32_t)(size) << ARM_I2C_SUBADDRESS_SIZE_SHIFT))
+
 /* I2C Driver state flags */
 #define I2C_FLAG_UNINIT (0UL)
 #define I2C_FLAG_INIT   (1UL << 0)
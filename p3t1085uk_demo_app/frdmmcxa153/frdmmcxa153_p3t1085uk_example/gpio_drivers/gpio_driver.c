@@ -26,6 +26,11 @@
 /* Driver Version */
 static const GENERIC_DRIVER_VERSION DriverVersion = {GPIO_API_VERSION, GPIO_DRV_VERSION};
 static gpioIsrObj_t isrObj[TOTAL_NUMBER_PORT][GPIO_NUMBER_OF_PIN];
+// Pins with an installed handler, one mask per priority level
+static uint32_t isrPriorityMask[TOTAL_NUMBER_PORT][GPIO_ISR_PRIORITY_LEVELS];
+#if (GPIO_DISPATCH_PROFILE > 0)
+static gpioDispatchStats_t dispatchStats;
+#endif
 static gpioConfigKSDK_t gpioConfigDefault = {
     .pinConfig = {kGPIO_DigitalInput, 0}, .portPinConfig = {0}, .interruptMode = kGPIO_InterruptFallingEdge};
 
@@ -78,6 +83,11 @@ void ksdk_gpio_pin_init(
         EnableIRQ(pinHandle->irq);
         isrObj[pinHandle->portNumber][pinHandle->pinNumber].isrHandle = aIsrHandler;
         isrObj[pinHandle->portNumber][pinHandle->pinNumber].pUserData = apUserData;
+        ksdk_gpio_set_pin_priority(aPinId, GPIO_ISR_PRIORITY_DEFAULT);
+#if (GPIO_DISPATCH_PROFILE > 0)
+        // The dispatcher timestamps its entry with the DWT cycle counter
+        MSDK_EnableCpuCycleCounter();
+#endif
         // Enable the interrupt on a pin.
         GPIO_SetPinInterruptConfig(pinHandle->base, pinHandle->pinNumber, pGpioConfig->interruptMode);
     }
@@ -143,33 +153,102 @@ uint32_t ksdk_gpio_read_pin(pinID_t aPinId)
     gpioHandleKSDK_t *pinHandle = (gpioHandleKSDK_t *)aPinId;
     return GPIO_PinRead(pinHandle->base, pinHandle->pinNumber);
 }
-#if 1
+/***********************************************************************
+ *
+ * Function Name : ksdk_gpio_set_pin_priority
+ * Description   : Move a pin handler to a dispatch priority level.
+ *
+ ***************************************************************************/
+void ksdk_gpio_set_pin_priority(pinID_t aPinId, uint8_t aPriority)
+{
+    gpioHandleKSDK_t *pinHandle = (gpioHandleKSDK_t *)aPinId;
+    uint32_t *pLevels = isrPriorityMask[pinHandle->portNumber];
+    uint32_t primask;
+
+    if (aPriority >= GPIO_ISR_PRIORITY_LEVELS)
+    {
+        aPriority = GPIO_ISR_PRIORITY_LEVELS - 1;
+    }
+
+    primask = DisableGlobalIRQ();
+    for (uint8_t level = 0; level < GPIO_ISR_PRIORITY_LEVELS; level++)
+    {
+        pLevels[level] &= ~pinHandle->mask;
+    }
+    pLevels[aPriority] |= pinHandle->mask;
+    EnableGlobalIRQ(primask);
+}
+
 /***********************************************************************
  *
  * Function Name : ksdk_gpio_handle_interrupt
  * Description   : handle the gpio interrupt in a pin.
  *
  ***************************************************************************/
-void ksdk_gpio_handle_interrupt(GPIO_Type *apBase, port_number_t aPortNumber)
+GPIO_RAMFUNC void ksdk_gpio_handle_interrupt(GPIO_Type *apBase, port_number_t aPortNumber)
 {
-    uint32_t isfr = GPIO_GpioGetInterruptFlags(apBase);
+#if (GPIO_DISPATCH_PROFILE > 0)
+    uint32_t entry = MSDK_GetCpuCycleCount();
+    uint32_t latency;
+#endif
+    const uint32_t *pLevels = isrPriorityMask[aPortNumber];
+    uint32_t installed = 0;
+    uint32_t pending;
+    uint32_t bits;
+    uint32_t pin;
+
+    for (uint8_t level = 0; level < GPIO_ISR_PRIORITY_LEVELS; level++)
+    {
+        installed |= pLevels[level];
+    }
 
-    // parse through all the pending interrupt for a PORT
-    for (uint8_t i = 0; i < GPIO_NUMBER_OF_PIN; i++)
+    // Acknowledge all serviced pins at once, pins without a handler stay pending as before
+    pending = GPIO_GpioGetInterruptFlags(apBase) & installed;
+    if (pending == 0U)
     {
-        if (isfr & (1 << i))
+        return;
+    }
+    GPIO_GpioClearInterruptFlags(apBase, pending);
+
+    // Walk only the set bits, highest priority level first
+    for (int8_t level = GPIO_ISR_PRIORITY_LEVELS - 1; level >= 0; level--)
+    {
+        bits = pending & pLevels[level];
+        while (bits != 0U)
         {
-            gpio_isr_handler_t handle = isrObj[aPortNumber][i].isrHandle;
-            if (handle == NULL)
+            pin = 31U - __CLZ(bits);
+            bits &= ~(1UL << pin);
+#if (GPIO_DISPATCH_PROFILE > 0)
+            latency = MSDK_GetCpuCycleCount() - entry;
+            dispatchStats.dispatchCount++;
+            dispatchStats.lastLatencyCycles = latency;
+            if (latency > dispatchStats.maxLatencyCycles)
             {
-                continue;
+                dispatchStats.maxLatencyCycles = latency;
             }
+#endif
             // call user defined handler
-            handle(isrObj[aPortNumber][i].pUserData);
-            GPIO_PinClearInterruptFlag(apBase, (1 << i));
+            isrObj[aPortNumber][pin].isrHandle(isrObj[aPortNumber][pin].pUserData);
         }
     }
 }
+
+#if (GPIO_DISPATCH_PROFILE > 0)
+/***********************************************************************
+ *
+ * Function Name : ksdk_gpio_get_dispatch_stats
+ * Description   : Read and reset the interrupt dispatcher statistics.
+ *
+ ***************************************************************************/
+void ksdk_gpio_get_dispatch_stats(gpioDispatchStats_t *pStats)
+{
+    uint32_t primask = DisableGlobalIRQ();
+
+    *pStats = dispatchStats;
+    dispatchStats.dispatchCount = 0;
+    dispatchStats.maxLatencyCycles = 0;
+    EnableGlobalIRQ(primask);
+}
 #endif
 GENERIC_DRIVER_GPIO Driver_GPIO_KSDK = {
     ksdk_gpio_get_version, ksdk_gpio_pin_init,  ksdk_gpio_set_pin,  ksdk_gpio_clr_pin,
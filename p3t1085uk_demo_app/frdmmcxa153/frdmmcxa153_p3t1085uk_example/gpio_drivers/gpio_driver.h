@@ -65,6 +65,41 @@ typedef struct gpioIsrObj
     gpio_isr_handler_t isrHandle; /*!< pointer to isrHandle.*/
 } gpioIsrObj_t;
 
+/*!
+ * @brief Number of dispatch priority levels of the pin interrupt handlers.
+ *        Pending pins of a higher level are dispatched first, pins within a level from the highest pin number down.
+ */
+#ifndef GPIO_ISR_PRIORITY_LEVELS
+#define GPIO_ISR_PRIORITY_LEVELS 4
+#endif
+#define GPIO_ISR_PRIORITY_DEFAULT 0 /*!< Priority of a handler installed by pin_init.*/
+
+/*!
+ * @brief Places the interrupt dispatcher in code RAM (RAM2), as SENSOR_RAMFUNC does for the sensor layer.
+ */
+#if defined(__MCUXPRESSO) && !defined(SENSOR_RAMFUNC_DISABLE)
+#define GPIO_RAMFUNC __attribute__((section(".ramfunc.$RAM2"), noinline))
+#else
+#define GPIO_RAMFUNC
+#endif
+
+/*!
+ * @brief Definition to enable cycle count profiling of the interrupt dispatcher.
+ */
+#ifndef GPIO_DISPATCH_PROFILE
+#define GPIO_DISPATCH_PROFILE 0
+#endif
+
+/*!
+ * @brief The gpio interrupt dispatcher statistics.
+ */
+typedef struct gpioDispatchStats
+{
+    uint32_t dispatchCount;     /*!< Number of handler calls.*/
+    uint32_t lastLatencyCycles; /*!< CPU cycles from dispatcher entry to the last handler call.*/
+    uint32_t maxLatencyCycles;  /*!< Largest value of lastLatencyCycles.*/
+} gpioDispatchStats_t;
+
 /*!
  * @brief Macro to create a Gpio handle
  */
@@ -78,6 +113,63 @@ typedef struct gpioIsrObj
                                                    .portNumber = PortNumber};
 
 #define GPIO_PIN_ID(PortName, PinNumber) &(PortName##PinNumber)
+
+/*!
+ * @brief Macro to initialize a Gpio handle from a board pin descriptor.
+ *        The board defines Name##_GPIO, Name##_PIN, Name##_IRQ, Name##_CLOCK and Name##_PORT_NUMBER.
+ */
+#define GPIO_PIN_HANDLE_INIT(Name)                                                                   \
+    {                                                                                                \
+        .base = Name##_GPIO, .pinNumber = Name##_PIN, .mask = 1U << (Name##_PIN), .irq = Name##_IRQ, \
+        .clockName = Name##_CLOCK, .portNumber = Name##_PORT_NUMBER                                  \
+    }
+
+/*!
+ * @brief Macro to create the direct register accessors of a board pin descriptor.
+ *        Name##_PinRead(), Name##_ClearInterruptFlag() and Name##_SetInterruptConfig() compile to
+ *        a single register access, without the pin handle and GENERIC_DRIVER_GPIO indirection.
+ */
+#define GPIO_PIN_DEFINE_ACCESSORS(Name)                                          \
+    static inline uint32_t Name##_PinRead(void)                                  \
+    {                                                                            \
+        return GPIO_PinRead(Name##_GPIO, Name##_PIN);                            \
+    }                                                                            \
+    static inline void Name##_ClearInterruptFlag(void)                           \
+    {                                                                            \
+        (Name##_GPIO)->ISFR[0] = 1UL << (Name##_PIN);                            \
+    }                                                                            \
+    static inline void Name##_SetInterruptConfig(gpio_interrupt_config_t config) \
+    {                                                                            \
+        GPIO_SetPinInterruptConfig(Name##_GPIO, Name##_PIN, config);             \
+    }
 extern GENERIC_DRIVER_GPIO Driver_GPIO_KSDK;
 
+/*!
+ * @brief Set the dispatch priority of a pin interrupt handler.
+ *
+ * @param aPinId     The pin, its handler must have been installed with pin_init.
+ * @param aPriority  0 (default) to GPIO_ISR_PRIORITY_LEVELS - 1, higher is dispatched first.
+ */
+void ksdk_gpio_set_pin_priority(pinID_t aPinId, uint8_t aPriority);
+
+/*!
+ * @brief Dispatch the pending pin interrupts of a port to their handlers.
+ *
+ * Only the pending pins with an installed handler are visited, and their flags are cleared
+ * with a single write before the handlers run so edges arriving meanwhile are not lost.
+ *
+ * @param apBase       The GPIO port base address.
+ * @param aPortNumber  The port number used at pin_init.
+ */
+void ksdk_gpio_handle_interrupt(GPIO_Type *apBase, port_number_t aPortNumber);
+
+#if (GPIO_DISPATCH_PROFILE > 0)
+/*!
+ * @brief Read and reset the interrupt dispatcher statistics.
+ *
+ * @param pStats  The statistics since the previous call.
+ */
+void ksdk_gpio_get_dispatch_stats(gpioDispatchStats_t *pStats);
+#endif
+
 #endif // __DRIVER_GPIO_H__
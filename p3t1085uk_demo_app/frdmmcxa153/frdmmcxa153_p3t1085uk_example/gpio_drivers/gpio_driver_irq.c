@@ -14,8 +14,6 @@
 #include "fsl_gpio.h"
 #include "gpio_driver.h"
 
-extern void ksdk_gpio_handle_interrupt(GPIO_Type *base, port_number_t portNumber);
-
 /*******************************************************************************
  * Functions - GPIOIRQ implementation
  ******************************************************************/
@@ -18,12 +18,38 @@
 /* ISSDK Includes */
 #include "issdk_hal.h"
 #include "register_io_i2c.h"
+#include "sensor_no_heap.h"
 
 /*******************************************************************************
  * Types
  ******************************************************************************/
 #define I2C_COUNT (sizeof(i2cBases) / sizeof(void *))
 
+/* The block writes of this file and of sensor_io_i2c.c are sized by the shield header. */
+_Static_assert((SENSOR_MAX_WRITE_BYTES > 0) && (SENSOR_MAX_WRITE_BYTES < SENSOR_MAX_REGISTER_COUNT),
+               "SENSOR_MAX_WRITE_BYTES of the shield header must be 1 to SENSOR_MAX_REGISTER_COUNT - 1");
+
+/*! @brief States of an asynchronous register read. */
+enum
+{
+    REGISTER_I2C_ASYNC_IDLE,    /*!< No asynchronous read on the instance. */
+    REGISTER_I2C_ASYNC_ADDRESS, /*!< Register offset being sent. */
+    REGISTER_I2C_ASYNC_DATA,    /*!< Register data being received. */
+};
+
+/*! @brief The asynchronous read context of an I2C instance. */
+typedef struct
+{
+    ARM_DRIVER_I2C *pCommDrv;
+    registerAsyncCallback_t callback;
+    void *pUserData;
+    uint8_t *pOutBuffer;
+    uint16_t slaveAddress;
+    uint8_t length;
+    uint8_t offset;
+    volatile uint8_t state;
+} registerAsyncRead_t;
+
 /*******************************************************************************
  * Variables
  ******************************************************************************/
@@ -34,131 +60,186 @@ I2C_Type *const i2cBases[] = I2C_BASE_PTRS;
 #endif
 volatile bool b_I2C_CompletionFlag[I2C_COUNT] = {false};
 volatile uint32_t g_I2C_ErrorEvent[I2C_COUNT] = {ARM_I2C_EVENT_TRANSFER_DONE};
+/* Set while a blocking transfer owns the instance, asynchronous reads are refused meanwhile. */
+static volatile bool b_I2C_SyncActive[I2C_COUNT] = {false};
+static registerAsyncRead_t g_I2C_AsyncRead[I2C_COUNT];
 
 /*******************************************************************************
  * Code
  ******************************************************************************/
 
-#if defined(I2C0)
-/* The I2C0 Signal Event Handler function. */
-void I2C0_SignalEvent_t(uint32_t event)
+/* Advance the asynchronous read of an instance on a driver event, called from the I2C interrupt. */
+SENSOR_RAMFUNC static void Register_I2C_AsyncEvent(registerAsyncRead_t *pAsync, uint32_t event)
+{
+    int32_t status = ARM_DRIVER_ERROR;
+
+    if (event == ARM_I2C_EVENT_TRANSFER_DONE)
+    {
+        if (pAsync->state == REGISTER_I2C_ASYNC_ADDRESS)
+        {
+            /* Offset sent, read the data after a repeated start. */
+            pAsync->state = REGISTER_I2C_ASYNC_DATA;
+            status = pAsync->pCommDrv->MasterReceive(pAsync->slaveAddress, pAsync->pOutBuffer, pAsync->length, false);
+            if (ARM_DRIVER_OK == status)
+            {
+                return;
+            }
+        }
+        else
+        {
+            status = ARM_DRIVER_OK;
+        }
+    }
+    else if (event & ARM_I2C_EVENT_TRANSFER_INCOMPLETE)
+    {
+        pAsync->pCommDrv->Control(ARM_I2C_ABORT_TRANSFER, 0);
+    }
+
+    pAsync->state = REGISTER_I2C_ASYNC_IDLE;
+    pAsync->callback(pAsync->pUserData, status);
+}
+
+/* Common body of the signal event handlers. */
+SENSOR_RAMFUNC static void Register_I2C_SignalEvent(uint8_t instance, uint32_t event)
 {
+    if (g_I2C_AsyncRead[instance].state != REGISTER_I2C_ASYNC_IDLE)
+    {
+        Register_I2C_AsyncEvent(&g_I2C_AsyncRead[instance], event);
+        return;
+    }
+
     if (event != ARM_I2C_EVENT_TRANSFER_DONE)
     {
-        g_I2C_ErrorEvent[0] = event;
+        g_I2C_ErrorEvent[instance] = event;
+    }
+    b_I2C_CompletionFlag[instance] = true;
+}
+
+/* Claim an instance for a blocking transfer, waiting for a pending asynchronous read to finish. */
+static void Register_I2C_SyncBegin(registerDeviceInfo_t *devInfo)
+{
+    b_I2C_SyncActive[devInfo->deviceInstance] = true;
+    while (g_I2C_AsyncRead[devInfo->deviceInstance].state != REGISTER_I2C_ASYNC_IDLE)
+    {
+        if (devInfo->idleFunction)
+        {
+            devInfo->idleFunction(devInfo->functionParam);
+        }
+        else
+        {
+            __NOP();
+        }
     }
-    b_I2C_CompletionFlag[0] = true;
+}
+
+static void Register_I2C_SyncEnd(registerDeviceInfo_t *devInfo)
+{
+    b_I2C_SyncActive[devInfo->deviceInstance] = false;
+}
+
+#if defined(I2C0)
+/* The I2C0 Signal Event Handler function. */
+SENSOR_RAMFUNC void I2C0_SignalEvent_t(uint32_t event)
+{
+    Register_I2C_SignalEvent(0, event);
 }
 #endif
 
 #if defined(I2C1)
 /* The I2C1 Signal Event Handler function. */
-void I2C1_SignalEvent_t(uint32_t event)
+SENSOR_RAMFUNC void I2C1_SignalEvent_t(uint32_t event)
 {
-    if (event != ARM_I2C_EVENT_TRANSFER_DONE)
-    {
-        g_I2C_ErrorEvent[1] = event;
-    }
-    b_I2C_CompletionFlag[1] = true;
+    Register_I2C_SignalEvent(1, event);
 }
 #endif
 
 #if defined(I2C2)
 /* The I2C2 Signal Event Handler function. */
-void I2C2_SignalEvent_t(uint32_t event)
+SENSOR_RAMFUNC void I2C2_SignalEvent_t(uint32_t event)
 {
-    if (event != ARM_I2C_EVENT_TRANSFER_DONE)
-    {
-        g_I2C_ErrorEvent[2] = event;
-    }
-    b_I2C_CompletionFlag[2] = true;
+    Register_I2C_SignalEvent(2, event);
 }
 #endif
 
 #if defined(I2C3)
 /* The I2C3 Signal Event Handler function. */
-void I2C3_SignalEvent_t(uint32_t event)
+SENSOR_RAMFUNC void I2C3_SignalEvent_t(uint32_t event)
 {
-    if (event != ARM_I2C_EVENT_TRANSFER_DONE)
-    {
-        g_I2C_ErrorEvent[3] = event;
-    }
-    b_I2C_CompletionFlag[3] = true;
+    Register_I2C_SignalEvent(3, event);
 }
 #endif
 
 #if defined(I2C4)
 /* The I2C4 Signal Event Handler function. */
-void I2C4_SignalEvent_t(uint32_t event)
+SENSOR_RAMFUNC void I2C4_SignalEvent_t(uint32_t event)
 {
-    if (event != ARM_I2C_EVENT_TRANSFER_DONE)
-    {
-        g_I2C_ErrorEvent[4] = event;
-    }
-    b_I2C_CompletionFlag[4] = true;
+    Register_I2C_SignalEvent(4, event);
 }
 #endif
 
 #if defined(I2C5)
 /* The I2C5 Signal Event Handler function. */
-void I2C5_SignalEvent_t(uint32_t event)
+SENSOR_RAMFUNC void I2C5_SignalEvent_t(uint32_t event)
 {
-    if (event != ARM_I2C_EVENT_TRANSFER_DONE)
-    {
-        g_I2C_ErrorEvent[5] = event;
-    }
-    b_I2C_CompletionFlag[5] = true;
+    Register_I2C_SignalEvent(5, event);
 }
 #endif
 
 #if defined(I2C6)
 /* The I2C6 Signal Event Handler function. */
-void I2C6_SignalEvent_t(uint32_t event)
+SENSOR_RAMFUNC void I2C6_SignalEvent_t(uint32_t event)
 {
-    if (event != ARM_I2C_EVENT_TRANSFER_DONE)
-    {
-        g_I2C_ErrorEvent[6] = event;
-    }
-    b_I2C_CompletionFlag[6] = true;
+    Register_I2C_SignalEvent(6, event);
 }
 #endif
 
 #if defined(I2C7)
 /* The I2C7 Signal Event Handler function. */
-void I2C7_SignalEvent_t(uint32_t event)
+SENSOR_RAMFUNC void I2C7_SignalEvent_t(uint32_t event)
 {
-    if (event != ARM_I2C_EVENT_TRANSFER_DONE)
-    {
-        g_I2C_ErrorEvent[7] = event;
-    }
-    b_I2C_CompletionFlag[7] = true;
+    Register_I2C_SignalEvent(7, event);
 }
 #endif
 
 #ifdef MIMXRT500_AGM01
 #if defined(I2C11)
 /* The I2C11 Signal Event Handler function. */
-void I2C11_SignalEvent_t(uint32_t event)
+SENSOR_RAMFUNC void I2C11_SignalEvent_t(uint32_t event)
 {
-    if (event != ARM_I2C_EVENT_TRANSFER_DONE)
-    {
-        g_I2C_ErrorEvent[11] = event;
-    }
-    b_I2C_CompletionFlag[11] = true;
+    Register_I2C_SignalEvent(11, event);
 }
 #endif
 #endif
 
-/*! The interface function to block write sensor registers. */
-int32_t Register_I2C_BlockWrite(ARM_DRIVER_I2C *pCommDrv,
-                                registerDeviceInfo_t *devInfo,
-                                uint16_t slaveAddress,
-                                uint8_t offset,
-                                const uint8_t *pBuffer,
-                                uint8_t bytesToWrite)
+/* Block write sensor registers, the caller owns the instance. */
+static int32_t Register_I2C_BlockWriteTransfer(ARM_DRIVER_I2C *pCommDrv,
+                                               registerDeviceInfo_t *devInfo,
+                                               uint16_t slaveAddress,
+                                               uint8_t offset,
+                                               const uint8_t *pBuffer,
+                                               uint8_t bytesToWrite)
 {
     int32_t status;
-    uint8_t buffer[SENSOR_MAX_REGISTER_COUNT];
+
+#if defined(ARM_I2C_SUBADDRESS)
+    /* The offset goes out of the LPI2C command FIFO ahead of the payload, in the same transfer. */
+    status = pCommDrv->Control(ARM_I2C_SUBADDRESS, ARM_I2C_SUBADDRESS_ARG(offset, 1U));
+    if (ARM_DRIVER_OK != status)
+    {
+        return status;
+    }
+
+    b_I2C_CompletionFlag[devInfo->deviceInstance] = false;
+    g_I2C_ErrorEvent[devInfo->deviceInstance] = ARM_I2C_EVENT_TRANSFER_DONE;
+    status = pCommDrv->MasterTransmit(slaveAddress, pBuffer, bytesToWrite, false);
+#else
+    uint8_t buffer[SENSOR_MAX_WRITE_BYTES + 1];
+
+    /* The buffer is sized for the sensors of the shield, one byte holds the register offset. */
+    if (bytesToWrite > SENSOR_MAX_WRITE_BYTES)
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
 
     buffer[0] = offset;
     memcpy(buffer + 1, pBuffer, bytesToWrite);
@@ -166,6 +247,7 @@ int32_t Register_I2C_BlockWrite(ARM_DRIVER_I2C *pCommDrv,
     b_I2C_CompletionFlag[devInfo->deviceInstance] = false;
     g_I2C_ErrorEvent[devInfo->deviceInstance] = ARM_I2C_EVENT_TRANSFER_DONE;
     status = pCommDrv->MasterTransmit(slaveAddress, buffer, bytesToWrite + 1, false);
+#endif
     if (ARM_DRIVER_OK == status)
     {
         /* Wait for completion */
@@ -193,14 +275,14 @@ int32_t Register_I2C_BlockWrite(ARM_DRIVER_I2C *pCommDrv,
     return status;
 }
 
-/*! The interface function to write a sensor register. */
-int32_t Register_I2C_Write(ARM_DRIVER_I2C *pCommDrv,
-                           registerDeviceInfo_t *devInfo,
-                           uint16_t slaveAddress,
-                           uint8_t offset,
-                           uint8_t value,
-                           uint8_t mask,
-                           bool repeatedStart)
+/* Write a sensor register, the caller owns the instance. */
+static int32_t Register_I2C_WriteTransfer(ARM_DRIVER_I2C *pCommDrv,
+                                          registerDeviceInfo_t *devInfo,
+                                          uint16_t slaveAddress,
+                                          uint8_t offset,
+                                          uint8_t value,
+                                          uint8_t mask,
+                                          bool repeatedStart)
 {
     int32_t status;
     uint8_t config[] = {offset, 0x00};
@@ -310,13 +392,13 @@ int32_t Register_I2C_Write(ARM_DRIVER_I2C *pCommDrv,
     return status;
 }
 
-/*! The interface function to read a sensor register. */
-int32_t Register_I2C_Read(ARM_DRIVER_I2C *pCommDrv,
-                          registerDeviceInfo_t *devInfo,
-                          uint16_t slaveAddress,
-                          uint8_t offset,
-                          uint8_t length,
-                          uint8_t *pOutBuffer)
+/* Read a sensor register, the caller owns the instance. */
+static int32_t Register_I2C_ReadTransfer(ARM_DRIVER_I2C *pCommDrv,
+                                         registerDeviceInfo_t *devInfo,
+                                         uint16_t slaveAddress,
+                                         uint8_t offset,
+                                         uint8_t length,
+                                         uint8_t *pOutBuffer)
 {
     int32_t status;
 
@@ -381,3 +463,99 @@ int32_t Register_I2C_Read(ARM_DRIVER_I2C *pCommDrv,
 
     return status;
 }
+
+/*! The interface function to block write sensor registers. */
+int32_t Register_I2C_BlockWrite(ARM_DRIVER_I2C *pCommDrv,
+                                registerDeviceInfo_t *devInfo,
+                                uint16_t slaveAddress,
+                                uint8_t offset,
+                                const uint8_t *pBuffer,
+                                uint8_t bytesToWrite)
+{
+    int32_t status;
+
+    Register_I2C_SyncBegin(devInfo);
+    status = Register_I2C_BlockWriteTransfer(pCommDrv, devInfo, slaveAddress, offset, pBuffer, bytesToWrite);
+    Register_I2C_SyncEnd(devInfo);
+
+    return status;
+}
+
+/*! The interface function to write a sensor register. */
+int32_t Register_I2C_Write(ARM_DRIVER_I2C *pCommDrv,
+                           registerDeviceInfo_t *devInfo,
+                           uint16_t slaveAddress,
+                           uint8_t offset,
+                           uint8_t value,
+                           uint8_t mask,
+                           bool repeatedStart)
+{
+    int32_t status;
+
+    Register_I2C_SyncBegin(devInfo);
+    status = Register_I2C_WriteTransfer(pCommDrv, devInfo, slaveAddress, offset, value, mask, repeatedStart);
+    Register_I2C_SyncEnd(devInfo);
+
+    return status;
+}
+
+/*! The interface function to read a sensor register. */
+int32_t Register_I2C_Read(ARM_DRIVER_I2C *pCommDrv,
+                          registerDeviceInfo_t *devInfo,
+                          uint16_t slaveAddress,
+                          uint8_t offset,
+                          uint8_t length,
+                          uint8_t *pOutBuffer)
+{
+    int32_t status;
+
+    Register_I2C_SyncBegin(devInfo);
+    status = Register_I2C_ReadTransfer(pCommDrv, devInfo, slaveAddress, offset, length, pOutBuffer);
+    Register_I2C_SyncEnd(devInfo);
+
+    return status;
+}
+
+/*! The interface function to start reading a sensor register without waiting. */
+int32_t Register_I2C_ReadAsync(ARM_DRIVER_I2C *pCommDrv,
+                               registerDeviceInfo_t *devInfo,
+                               uint16_t slaveAddress,
+                               uint8_t offset,
+                               uint8_t length,
+                               uint8_t *pOutBuffer,
+                               registerAsyncCallback_t callback,
+                               void *pUserData)
+{
+    registerAsyncRead_t *pAsync = &g_I2C_AsyncRead[devInfo->deviceInstance];
+    uint32_t primask;
+    int32_t status;
+
+    if (callback == NULL)
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+
+    primask = DisableGlobalIRQ();
+    if (b_I2C_SyncActive[devInfo->deviceInstance] || (pAsync->state != REGISTER_I2C_ASYNC_IDLE))
+    {
+        EnableGlobalIRQ(primask);
+        return ARM_DRIVER_ERROR_BUSY;
+    }
+    pAsync->pCommDrv = pCommDrv;
+    pAsync->callback = callback;
+    pAsync->pUserData = pUserData;
+    pAsync->pOutBuffer = pOutBuffer;
+    pAsync->slaveAddress = slaveAddress;
+    pAsync->length = length;
+    pAsync->offset = offset;
+    pAsync->state = REGISTER_I2C_ASYNC_ADDRESS;
+    EnableGlobalIRQ(primask);
+
+    status = pCommDrv->MasterTransmit(slaveAddress, &pAsync->offset, 1, true);
+    if (ARM_DRIVER_OK != status)
+    {
+        pAsync->state = REGISTER_I2C_ASYNC_IDLE;
+    }
+
+    return status;
+}
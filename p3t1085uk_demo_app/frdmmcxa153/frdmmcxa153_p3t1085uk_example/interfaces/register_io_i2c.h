@@ -18,6 +18,13 @@
 #include "sensor_drv.h"
 #include "Driver_I2C.h"
 
+/*! @brief       Completion callback of an asynchronous register read.
+ *  @details     Called from the I2C interrupt once the read has finished or failed.
+ *  @param[in]   pUserData The pointer given to Register_I2C_ReadAsync().
+ *  @param[in]   status    ARM_DRIVER_OK if the data is valid, ARM_DRIVER_ERROR otherwise.
+ */
+typedef void (*registerAsyncCallback_t)(void *pUserData, int32_t status);
+
 #if defined(I2C0)
 /*! @brief The I2C0 device index. */
 #define I2C0_INDEX 0
@@ -207,4 +214,32 @@ int32_t Register_I2C_Read(ARM_DRIVER_I2C *pCommDrv,
                           uint8_t length,
                           uint8_t *pOutBuffer);
 
+/*!
+ * @brief The interface function to start reading a sensor register without waiting.
+ *
+ * The register offset and the data are transferred from the I2C interrupt and the result
+ * is delivered through the callback, so the function can be called from an interrupt handler.
+ * Blocking transfers on the same instance wait for a pending asynchronous read to finish.
+ *
+ * @param ARM_DRIVER_I2C *pCommDrv - The I2C driver to use.
+ * @param registerDeviceInfo_t *devInfo - The I2C device number and idle function.
+ * @param uint16_t slaveAddress - the sensor's I2C slave address.
+ * @param uint8_t offset - The register/offset to read from
+ * @param uint8_t length - The number of bytes to read
+ * @param uint8_t *pOutBuffer - The buffer to store the register value, it must stay valid until the callback.
+ * @param registerAsyncCallback_t callback - The function called when the read has finished.
+ * @param void *pUserData - The pointer passed to the callback.
+ *
+ * @return ARM_DRIVER_OK if the read was started, ARM_DRIVER_ERROR_BUSY if the instance is in use
+ *         or ARM_DRIVER_ERROR if error.
+ */
+int32_t Register_I2C_ReadAsync(ARM_DRIVER_I2C *pCommDrv,
+                               registerDeviceInfo_t *devInfo,
+                               uint16_t slaveAddress,
+                               uint8_t offset,
+                               uint8_t length,
+                               uint8_t *pOutBuffer,
+                               registerAsyncCallback_t callback,
+                               void *pUserData);
+
 #endif // __REGISTER_IO_I2C_H__
@@ -36,11 +36,26 @@ enum ESensorErrors
     SENSOR_ERROR_INIT,
     SENSOR_ERROR_WRITE,
     SENSOR_ERROR_READ,
+    SENSOR_ERROR_BUSY,
 };
 
 /* The MAXIMUM number of Sensor Registers possible. */
 #define SENSOR_MAX_REGISTER_COUNT 128 /* As per 7-Bit address. */
 
+/* SENSOR_MAX_WRITE_BYTES, the largest payload of a register block write, is defined by the shield header
+ * only. The interface buffers are sized from it and check it against SENSOR_MAX_REGISTER_COUNT. */
+
+/* Width of the registers described by registerwritelist16_t. */
+#define SENSOR_REG16_SIZE_BYTES 2
+
+/* Places an interrupt path function in code RAM (RAM2: SRAMX on MCXN947, SRAMX0 on MCXA153) so that it
+ * runs without flash wait states. The startup code copies .ramfunc.$RAM2 from flash with the data. */
+#if defined(__MCUXPRESSO) && !defined(SENSOR_RAMFUNC_DISABLE)
+#define SENSOR_RAMFUNC __attribute__((section(".ramfunc.$RAM2"), noinline))
+#else
+#define SENSOR_RAMFUNC
+#endif
+
 /* Used with the RegisterWriteList types as a list terminator */
 #define __END_WRITE_DATA__            \
     {                                 \
@@ -72,6 +87,17 @@ typedef struct
     uint8_t mask;     /* mask of the field to be set with given value.*/
 } registerwritelist_t;
 
+/*!
+ * @brief This structure defines the Write command List for 16-bit registers.
+ *        The value is transferred MSB first. Terminate the list with __END_WRITE_DATA__.
+ */
+typedef struct
+{
+    uint16_t writeTo; /* Address where the value is writes to.*/
+    uint16_t value;   /* value. Note that value should be shifted based on the bit position.*/
+    uint16_t mask;    /* mask of the field to be set with given value, 0 overwrites the whole register.*/
+} registerwritelist16_t;
+
 /*!
  * @brief This structure defines the Read command List.
  */
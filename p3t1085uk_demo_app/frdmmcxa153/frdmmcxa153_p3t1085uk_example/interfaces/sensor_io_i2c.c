@@ -13,9 +13,17 @@
  */
 
 #include "Driver_I2C.h"
+#include "issdk_hal.h"
 #include "sensor_drv.h"
 #include "systick_utils.h"
 #include "sensor_io_i2c.h"
+#include "sensor_no_heap.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Largest block handled by Register_I2C_BlockWrite(). */
+#define SENSOR_I2C_MAX_BLOCK_BYTES SENSOR_MAX_WRITE_BYTES
 
 /*******************************************************************************
  * Code
@@ -130,3 +138,116 @@ int32_t Sensor_I2C_Read(ARM_DRIVER_I2C *pCommDrv,
     }
     return SENSOR_ERROR_NONE;
 }
+
+/*! The interface function to write 16-bit register data to a sensor. */
+int32_t Sensor_I2C_Write16(ARM_DRIVER_I2C *pCommDrv,
+                           registerDeviceInfo_t *devInfo,
+                           uint16_t slaveAddress,
+                           const registerwritelist16_t *pRegWriteList,
+                           uint8_t bytesPerAddress)
+{
+    int32_t status;
+    uint8_t buffer[SENSOR_I2C_MAX_BLOCK_BYTES];
+    uint16_t current;
+    uint32_t count;
+    uint32_t i;
+    bool readBack;
+
+    /*! Validate for the correct handle.*/
+    if ((pCommDrv == NULL) || (pRegWriteList == NULL) || (bytesPerAddress > SENSOR_REG16_SIZE_BYTES))
+    {
+        return SENSOR_ERROR_BAD_ADDRESS;
+    }
+
+    const registerwritelist16_t *pCmd = pRegWriteList;
+
+    /*! Update register values based on register write list until the list terminator */
+    while (pCmd->writeTo != 0xFFFF)
+    {
+        /*! Gather the run of entries at contiguous addresses, one register when the pointer does not auto-increment. */
+        readBack = (pCmd->mask != 0);
+        for (count = 1; (bytesPerAddress != 0) && ((count + 1) * SENSOR_REG16_SIZE_BYTES <= sizeof(buffer)) &&
+                        (pCmd[count].writeTo != 0xFFFF) &&
+                        (pCmd[count].writeTo == pCmd->writeTo + count * (SENSOR_REG16_SIZE_BYTES / bytesPerAddress));
+             count++)
+        {
+            readBack |= (pCmd[count].mask != 0);
+        }
+
+        /*! Masked entries need the current contents, read the whole run at once.*/
+        if (readBack)
+        {
+            status = Register_I2C_Read(pCommDrv, devInfo, slaveAddress, pCmd->writeTo, count * SENSOR_REG16_SIZE_BYTES,
+                                       buffer);
+            if (ARM_DRIVER_OK != status)
+            {
+                return SENSOR_ERROR_READ;
+            }
+        }
+
+        for (i = 0; i < count; i++)
+        {
+            current = pCmd[i].value;
+            if (pCmd[i].mask)
+            {
+                /*! 'OR' in the requested values to the current contents of the register */
+                current = (uint16_t)(((uint16_t)buffer[2 * i] << 8) | buffer[2 * i + 1]);
+                current = (current & ~pCmd[i].mask) | pCmd[i].value;
+            }
+            buffer[2 * i]     = (uint8_t)(current >> 8);
+            buffer[2 * i + 1] = (uint8_t)current;
+        }
+
+        status = Register_I2C_BlockWrite(pCommDrv, devInfo, slaveAddress, pCmd->writeTo, buffer,
+                                         count * SENSOR_REG16_SIZE_BYTES);
+        if (ARM_DRIVER_OK != status)
+        {
+            return SENSOR_ERROR_WRITE;
+        }
+        pCmd += count;
+    }
+
+    return SENSOR_ERROR_NONE;
+}
+
+/*! The interface function to read register data from a sensor merging contiguous entries. */
+int32_t Sensor_I2C_ReadCoalesced(ARM_DRIVER_I2C *pCommDrv,
+                                 registerDeviceInfo_t *devInfo,
+                                 uint16_t slaveAddress,
+                                 const registerreadlist_t *pReadList,
+                                 uint8_t bytesPerAddress,
+                                 uint8_t *pOutBuffer)
+{
+    int32_t status;
+    uint32_t length;
+    uint8_t *pBuf;
+
+    /*! Validate for the correct handle.*/
+    if (pCommDrv == NULL || pReadList == NULL || pOutBuffer == NULL)
+    {
+        return SENSOR_ERROR_BAD_ADDRESS;
+    }
+    const registerreadlist_t *pCmd = pReadList;
+    const registerreadlist_t *pNext;
+
+    for (pBuf = pOutBuffer; pCmd->numBytes != 0; pCmd = pNext)
+    {
+        /*! Extend the transfer while the next entry starts where the current run ends.*/
+        length = pCmd->numBytes;
+        for (pNext = pCmd + 1; (bytesPerAddress != 0) && (pNext->numBytes != 0) &&
+                               (length + pNext->numBytes <= 0xFF) && ((length % bytesPerAddress) == 0) &&
+                               (pNext->readFrom == pCmd->readFrom + length / bytesPerAddress);
+             pNext++)
+        {
+            length += pNext->numBytes;
+        }
+
+        status = Register_I2C_Read(pCommDrv, devInfo, slaveAddress, pCmd->readFrom, (uint8_t)length, pBuf);
+        if (ARM_DRIVER_OK != status)
+        {
+            return SENSOR_ERROR_READ;
+        }
+        pBuf += length;
+    }
+    return SENSOR_ERROR_NONE;
+}
@@ -29,6 +29,7 @@ enum
 };
 
 #define P3T1085UK_REG_SIZE_BYTES	2
+#define P3T1085UK_BYTES_PER_ADDRESS	0 /*!< The register pointer does not auto-increment. */
 #define P3T1085UK_CELCIUS_CONV_VAL	0.0625
 #define P3T1085UK_TEMP_IGNORE_SHIFT	((uint16_t)4)
 #define P3T1085UK_DEVICE_ADDRESS        (0x48) /*!< Device Address Value. */
@@ -47,6 +48,15 @@ enum
 #define P3T1085UK_CONFIG_POL_SHIFT       ((uint16_t)7)
 #define P3T1085UK_CONFIG_HYST_MASK       ((uint16_t)0x0030)
 #define P3T1085UK_CONFIG_HYST_SHIFT       ((uint16_t)4)
+#define P3T1085UK_CONFIG_RO_MASK       (P3T1085UK_CONFIG_FH_MASK | P3T1085UK_CONFIG_FL_MASK)
+
+/*! @brief Compose a CONFIG register value from its conversion rate, mode, thermostat mode, polarity and hysteresis fields. */
+#define P3T1085UK_CONFIG_VALUE(cr, mode, tm, pol, hyst)                                          \
+    ((uint16_t)((((uint16_t)(cr) << P3T1085UK_CONFIG_CR_SHIFT) & P3T1085UK_CONFIG_CR_MASK) |       \
+                (((uint16_t)(tm) << P3T1085UK_CONFIG_TM_SHIFT) & P3T1085UK_CONFIG_TM_MASK) |       \
+                (((uint16_t)(mode) << P3T1085UK_CONFIG_MODE_SHIFT) & P3T1085UK_CONFIG_MODE_MASK) | \
+                (((uint16_t)(pol) << P3T1085UK_CONFIG_POL_SHIFT) & P3T1085UK_CONFIG_POL_MASK) |    \
+                (((uint16_t)(hyst) << P3T1085UK_CONFIG_HYST_SHIFT) & P3T1085UK_CONFIG_HYST_MASK)))
 
 #define P3T1085UK_TEMP_NEGPOS_MASK       ((uint16_t)0x8000)
 #define P3T1085UK_TEMP_NEGPOS_SHIFT       ((uint16_t)15)
@@ -54,6 +64,12 @@ enum
 #define P3T1085UK_TEMP_CALC_MASK       ((uint16_t)0xFFF0)
 #define P3T1085UK_TEMP_CALC_SHIFT       ((uint16_t)4)
 
+/*! @brief Convert a temperature in Celsius to a TLOW/THIGH register value, rounded to the nearest 0.0625°C step.
+ *         Intended for constant initializers, the argument is evaluated more than once. */
+#define P3T1085UK_TEMP_REG_VALUE(cel)                                                                       \
+    ((uint16_t)((uint16_t)(int16_t)(((cel) / P3T1085UK_CELCIUS_CONV_VAL) + (((cel) < 0) ? -0.5 : 0.5)) \
+                << P3T1085UK_TEMP_CALC_SHIFT))
+
 #define P3T1085UK_MAX_THIGH_VALUE_CEL	127.9375
 #define P3T1085UK_MIN_TLOW_VALUE_CEL	-75.00
 #endif
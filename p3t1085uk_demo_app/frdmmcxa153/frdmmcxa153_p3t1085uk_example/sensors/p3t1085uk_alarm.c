@@ -0,0 +1,169 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file p3t1085uk_alarm.c
+ * @brief The p3t1085uk_alarm.c file implements the P3T1085UK comparator-mode alarm engine.
+ */
+
+//-----------------------------------------------------------------------
+// ISSDK Includes
+//-----------------------------------------------------------------------
+#include "fsl_common.h"
+#include "p3t1085uk_alarm.h"
+#include "deferred_log.h"
+#include "sensor_no_heap.h"
+
+//-----------------------------------------------------------------------
+// Constants
+//-----------------------------------------------------------------------
+/*! @brief Hysteresis in 1/16 celsius units, indexed by enum EHysteresis. */
+static const int16_t cHystQ4[] = {0, 16, 32, 64};
+
+//-----------------------------------------------------------------------
+// Functions
+//-----------------------------------------------------------------------
+/* The threshold an active ALERT belongs to, judged from the last known temperature. */
+static enum EAlarmState P3T1085_Alarm_Classify(const p3t1085_alarm_t *pAlarm)
+{
+    /* Within the hysteresis band of a threshold the flag of that threshold can still be set. */
+    if (pAlarm->tempQ4 > (pAlarm->tHighQ4 - pAlarm->hystQ4))
+    {
+        return P3T1085UK_ALARM_OVER;
+    }
+    if (pAlarm->tempQ4 < (pAlarm->tLowQ4 + pAlarm->hystQ4))
+    {
+        return P3T1085UK_ALARM_UNDER;
+    }
+
+    /* The temperature has moved since it was read, the nearer threshold was crossed. */
+    return (((int32_t)pAlarm->tempQ4 * 2) >= ((int32_t)pAlarm->tLowQ4 + pAlarm->tHighQ4)) ? P3T1085UK_ALARM_OVER :
+                                                                                           P3T1085UK_ALARM_UNDER;
+}
+
+static void P3T1085_Alarm_Change(p3t1085_alarm_t *pAlarm, enum EAlarmState state)
+{
+    enum EAlarmState from = pAlarm->state;
+
+    if (from == state)
+    {
+        return;
+    }
+    pAlarm->state = state;
+    DLOG("P3T1085 alarm %u -> %u\r\n", from, state);
+    if (pAlarm->callback != NULL)
+    {
+        pAlarm->callback(pAlarm->pUserData, from, state);
+    }
+}
+
+int32_t P3T1085_Alarm_Init(p3t1085_alarm_t *pAlarm,
+                           const p3t1085_config_t *pConfig,
+                           int16_t tempQ4,
+                           uint32_t glitchTicks,
+                           p3t1085_alarm_callback_t callback,
+                           void *pUserData)
+{
+    /*! Check the input parameters. */
+    if ((pAlarm == NULL) || (pConfig == NULL))
+    {
+        return SENSOR_ERROR_INVALID_PARAM;
+    }
+
+    /*! The ALERT level only follows the temperature in comparator mode. */
+    if ((pConfig->config & P3T1085UK_CONFIG_TM_MASK) != ((uint16_t)P3T1085UK_TS_COMP << P3T1085UK_CONFIG_TM_SHIFT))
+    {
+        return SENSOR_ERROR_INVALID_PARAM;
+    }
+
+    pAlarm->tLowQ4 = P3T1085UK_TEMP_REG_TO_Q4(pConfig->tlow);
+    pAlarm->tHighQ4 = P3T1085UK_TEMP_REG_TO_Q4(pConfig->thigh);
+    pAlarm->hystQ4 = cHystQ4[(pConfig->config & P3T1085UK_CONFIG_HYST_MASK) >> P3T1085UK_CONFIG_HYST_SHIFT];
+    pAlarm->activeHigh = (pConfig->config & P3T1085UK_CONFIG_POL_MASK) != 0U;
+    pAlarm->tempQ4 = tempQ4;
+    pAlarm->glitchTicks = glitchTicks;
+    pAlarm->state = P3T1085UK_ALARM_NORMAL;
+    pAlarm->edgePending = false;
+    pAlarm->callback = callback;
+    pAlarm->pUserData = pUserData;
+
+    return SENSOR_ERROR_NONE;
+}
+
+SENSOR_RAMFUNC void P3T1085_Alarm_OnEdge(p3t1085_alarm_t *pAlarm, bool level, uint32_t ticks)
+{
+    uint32_t primask = DisableGlobalIRQ();
+
+    pAlarm->edgeLevel = level;
+    pAlarm->edgeTicks = ticks;
+    pAlarm->edgePending = true;
+    EnableGlobalIRQ(primask);
+}
+
+enum EAlarmState P3T1085_Alarm_Process(p3t1085_alarm_t *pAlarm, bool level, uint32_t ticks)
+{
+    uint32_t primask;
+    bool edgeLevel;
+
+    primask = DisableGlobalIRQ();
+    if (!pAlarm->edgePending || ((ticks - pAlarm->edgeTicks) < pAlarm->glitchTicks))
+    {
+        EnableGlobalIRQ(primask);
+        return pAlarm->state;
+    }
+    pAlarm->edgePending = false;
+    edgeLevel = pAlarm->edgeLevel;
+    EnableGlobalIRQ(primask);
+
+    /*! A level which did not last for the whole window is a glitch. */
+    if (edgeLevel != level)
+    {
+        DLOG("P3T1085 alarm glitch\r\n");
+        return pAlarm->state;
+    }
+
+    if (level == pAlarm->activeHigh)
+    {
+        if (pAlarm->state == P3T1085UK_ALARM_NORMAL)
+        {
+            P3T1085_Alarm_Change(pAlarm, P3T1085_Alarm_Classify(pAlarm));
+        }
+    }
+    else
+    {
+        P3T1085_Alarm_Change(pAlarm, P3T1085UK_ALARM_NORMAL);
+    }
+
+    return pAlarm->state;
+}
+
+void P3T1085_Alarm_UpdateTemp(p3t1085_alarm_t *pAlarm, int16_t tempQ4)
+{
+    pAlarm->tempQ4 = tempQ4;
+
+    /*! An active alarm moves to the threshold the temperature is actually beyond. */
+    if (((pAlarm->state == P3T1085UK_ALARM_UNDER) && (tempQ4 >= pAlarm->tHighQ4)) ||
+        ((pAlarm->state == P3T1085UK_ALARM_OVER) && (tempQ4 <= pAlarm->tLowQ4)))
+    {
+        P3T1085_Alarm_Change(pAlarm, P3T1085_Alarm_Classify(pAlarm));
+    }
+}
+
+void P3T1085_Alarm_SetThresholds(p3t1085_alarm_t *pAlarm, int16_t tLowQ4, int16_t tHighQ4)
+{
+    pAlarm->tLowQ4 = tLowQ4;
+    pAlarm->tHighQ4 = tHighQ4;
+}
+
+void P3T1085_Alarm_SetHysteresis(p3t1085_alarm_t *pAlarm, enum EHysteresis eHyst)
+{
+    pAlarm->hystQ4 = cHystQ4[eHyst & 0x3U];
+}
+
+void P3T1085_Alarm_SetPolarity(p3t1085_alarm_t *pAlarm, enum EPolarity ePol)
+{
+    pAlarm->activeHigh = (ePol == P3T1085UK_POL_ACTIVE_HIGH);
+}
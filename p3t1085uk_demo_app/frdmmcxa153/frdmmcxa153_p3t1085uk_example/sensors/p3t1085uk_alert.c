@@ -0,0 +1,226 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file p3t1085uk_alert.c
+ * @brief The p3t1085uk_alert.c file implements the P3T1085UK ALERT router.
+ */
+
+//-----------------------------------------------------------------------
+// ISSDK Includes
+//-----------------------------------------------------------------------
+#include "fsl_common.h"
+#include "issdk_hal.h"
+#include "p3t1085uk_alert.h"
+#include "deferred_log.h"
+#include "sensor_no_heap.h"
+
+//-----------------------------------------------------------------------
+// Types
+//-----------------------------------------------------------------------
+/*! @brief An ALERT pin bound to its sensor. */
+typedef struct
+{
+    GENERIC_DRIVER_GPIO *pGpioDriver;
+    pinID_t alertPin;
+    p3t1085_alarm_t *pAlarm;               /*!< Alarm engine fed with the edges, may be NULL.*/
+    p3t1085_i2c_sensorhandle_t *pSensorHandle;
+    p3t1085_alert_callback_t callback;
+    void *pUserData;
+    uint32_t edgeCycles;                   /*!< Cycle count when the edge was dispatched.*/
+    uint8_t raw[P3T1085UK_REG_SIZE_BYTES]; /*!< Temp register, filled by the asynchronous read.*/
+    volatile bool deferred;                /*!< Edge waiting for its bus.*/
+} p3t1085_alert_route_t;
+
+//-----------------------------------------------------------------------
+// Global Variables
+//-----------------------------------------------------------------------
+static p3t1085_alert_route_t gAlertRoutes[P3T1085_ALERT_MAX_ROUTES];
+static uint8_t gAlertRouteCount = 0;
+
+//-----------------------------------------------------------------------
+// Functions
+//-----------------------------------------------------------------------
+static void P3T1085_Alert_ReadDone(void *pUserData, int32_t status);
+
+/* Level of the ALERT pin of a route, read through the board accessor when it is the board ALERT pin. */
+static inline bool P3T1085_Alert_PinLevel(const p3t1085_alert_route_t *pRoute)
+{
+#if defined(ALERT_GPIO)
+    if (pRoute->alertPin == &ALERT_LED)
+    {
+        return ALERT_PinRead() != 0U;
+    }
+#endif
+    return pRoute->pGpioDriver->read_pin(pRoute->alertPin) != 0U;
+}
+
+/* Start the read of a route, or defer it while its bus is in use. */
+SENSOR_RAMFUNC static void P3T1085_Alert_Start(p3t1085_alert_route_t *pRoute)
+{
+    int32_t status;
+
+    status = P3T1085_I2C_StartTempRead(pRoute->pSensorHandle, pRoute->raw, P3T1085_Alert_ReadDone, pRoute);
+    if (SENSOR_ERROR_BUSY == status)
+    {
+        pRoute->deferred = true;
+        return;
+    }
+
+    pRoute->deferred = false;
+    if (SENSOR_ERROR_NONE != status)
+    {
+        pRoute->callback(pRoute->pUserData, status, 0, MSDK_GetCpuCycleCount() - pRoute->edgeCycles);
+    }
+}
+
+/* Start the deferred reads, each bus accepts one and refuses the others again. */
+static void P3T1085_Alert_StartDeferred(void)
+{
+    uint32_t primask;
+
+    for (uint8_t i = 0; i < gAlertRouteCount; i++)
+    {
+        primask = DisableGlobalIRQ();
+        if (gAlertRoutes[i].deferred)
+        {
+            P3T1085_Alert_Start(&gAlertRoutes[i]);
+        }
+        EnableGlobalIRQ(primask);
+    }
+}
+
+/* GPIO interrupt: the ALERT edge of a route. */
+SENSOR_RAMFUNC static void P3T1085_Alert_EdgeHandler(void *pUserData)
+{
+    p3t1085_alert_route_t *pRoute = (p3t1085_alert_route_t *)pUserData;
+    bool level;
+
+    pRoute->edgeCycles = MSDK_GetCpuCycleCount();
+    DLOG("ALERT edge, sensor 0x%x\r\n", pRoute->pSensorHandle->slaveAddress);
+    if (pRoute->pAlarm != NULL)
+    {
+        level = P3T1085_Alert_PinLevel(pRoute);
+        P3T1085_Alarm_OnEdge(pRoute->pAlarm, level, pRoute->edgeCycles);
+        /* The pin interrupts on both edges for the alarm, the release edge only feeds it. */
+        if (level != pRoute->pAlarm->activeHigh)
+        {
+            return;
+        }
+    }
+    if (pRoute->callback != NULL)
+    {
+        P3T1085_Alert_Start(pRoute);
+    }
+}
+
+/* I2C interrupt: the asynchronous read of a route has finished. */
+SENSOR_RAMFUNC static void P3T1085_Alert_ReadDone(void *pUserData, int32_t status)
+{
+    p3t1085_alert_route_t *pRoute = (p3t1085_alert_route_t *)pUserData;
+    uint32_t latency = MSDK_GetCpuCycleCount() - pRoute->edgeCycles;
+    int16_t tempQ4 = 0;
+
+    if (ARM_DRIVER_OK == status)
+    {
+        tempQ4 = P3T1085_I2C_TempRawToQ4(pRoute->raw);
+        pRoute->callback(pRoute->pUserData, SENSOR_ERROR_NONE, tempQ4, latency);
+    }
+    else
+    {
+        DLOG("ALERT read failed, sensor 0x%x\r\n", pRoute->pSensorHandle->slaveAddress);
+        pRoute->callback(pRoute->pUserData, SENSOR_ERROR_READ, tempQ4, latency);
+    }
+
+    /* The bus is free again, serve the edges which arrived meanwhile. */
+    P3T1085_Alert_StartDeferred();
+}
+
+int32_t P3T1085_Alert_AddRoute(GENERIC_DRIVER_GPIO *pGpioDriver,
+                               pinID_t alertPin,
+                               void *pPinConfig,
+                               p3t1085_i2c_sensorhandle_t *pSensorHandle,
+                               p3t1085_alert_callback_t callback,
+                               void *pUserData)
+{
+    p3t1085_alert_route_t *pRoute;
+
+    /*! Check the input parameters. */
+    if ((pGpioDriver == NULL) || (alertPin == NULL) || (pSensorHandle == NULL))
+    {
+        return SENSOR_ERROR_INVALID_PARAM;
+    }
+
+    /*! Check whether sensor handle is initialized before routing its ALERT.*/
+    if (pSensorHandle->isInitialized != true)
+    {
+        return SENSOR_ERROR_INIT;
+    }
+
+    if (gAlertRouteCount >= P3T1085_ALERT_MAX_ROUTES)
+    {
+        return SENSOR_ERROR_INVALID_PARAM;
+    }
+
+    pRoute = &gAlertRoutes[gAlertRouteCount++];
+    pRoute->pGpioDriver = pGpioDriver;
+    pRoute->alertPin = alertPin;
+    pRoute->pAlarm = NULL;
+    pRoute->pSensorHandle = pSensorHandle;
+    pRoute->callback = callback;
+    pRoute->pUserData = pUserData;
+    pRoute->deferred = false;
+
+    MSDK_EnableCpuCycleCounter();
+    pGpioDriver->pin_init(alertPin, GPIO_DIRECTION_IN, pPinConfig, P3T1085_Alert_EdgeHandler, pRoute);
+
+    return SENSOR_ERROR_NONE;
+}
+
+int32_t P3T1085_Alert_AttachAlarm(p3t1085_i2c_sensorhandle_t *pSensorHandle, p3t1085_alarm_t *pAlarm)
+{
+    p3t1085_alert_route_t *pRoute;
+    uint32_t primask;
+
+    /*! Check the input parameters. */
+    if ((pSensorHandle == NULL) || (pAlarm == NULL))
+    {
+        return SENSOR_ERROR_INVALID_PARAM;
+    }
+
+    for (uint8_t i = 0; i < gAlertRouteCount; i++)
+    {
+        pRoute = &gAlertRoutes[i];
+        if (pRoute->pSensorHandle == pSensorHandle)
+        {
+            /* An alarm already active at start has no edge, report the level as one. */
+            primask = DisableGlobalIRQ();
+            pRoute->pAlarm = pAlarm;
+            P3T1085_Alarm_OnEdge(pAlarm, P3T1085_Alert_PinLevel(pRoute), MSDK_GetCpuCycleCount());
+            EnableGlobalIRQ(primask);
+            return SENSOR_ERROR_NONE;
+        }
+    }
+
+    return SENSOR_ERROR_INVALID_PARAM;
+}
+
+void P3T1085_Alert_Poll(void)
+{
+    p3t1085_alert_route_t *pRoute;
+
+    P3T1085_Alert_StartDeferred();
+
+    for (uint8_t i = 0; i < gAlertRouteCount; i++)
+    {
+        pRoute = &gAlertRoutes[i];
+        /*! The pin is only sampled while an edge waits for its glitch window to elapse. */
+        if ((pRoute->pAlarm != NULL) && pRoute->pAlarm->edgePending)
+        {
+            P3T1085_Alarm_Process(pRoute->pAlarm, P3T1085_Alert_PinLevel(pRoute), MSDK_GetCpuCycleCount());
+        }
+    }
+}
@@ -0,0 +1,36 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file p3t1085uk_crc.h
+ * @brief The p3t1085uk_crc.h file describes the CRC-32 of the P3T1085UK images and records.
+
+    The configuration snapshot and the flash log store close their data with the CRC-32 of
+    IEEE 802.3, the one of zlib. It is computed a nibble at a time from a 16-entry table, which
+    keeps the table at 64 bytes of flash for the few hundred bytes checked at a time.
+*/
+
+#ifndef P3T1085UK_CRC_H_
+#define P3T1085UK_CRC_H_
+
+/* Standard C Includes */
+#include <stdint.h>
+
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+/*! @brief       The interface function to compute a CRC-32.
+ *  @details     Start with a crc of 0, then pass the result back to continue over the next bytes.
+ *  @param[in]   crc      the CRC-32 of the bytes before, 0 to start.
+ *  @param[in]   pData    the bytes.
+ *  @param[in]   size     the number of bytes.
+ *  @constraints None
+ *  @reeentrant  Yes
+ *  @return      ::P3T1085_Crc32() returns the CRC-32 of the bytes so far.
+ */
+uint32_t P3T1085_Crc32(uint32_t crc, const uint8_t *pData, uint32_t size);
+
+#endif /* P3T1085UK_CRC_H_ */
@@ -35,6 +35,23 @@ typedef struct
     uint16_t slaveAddress;           /*!< slave address.*/
 } p3t1085_i2c_sensorhandle_t;
 
+/*!
+ * @brief This defines a complete register configuration, one 16-bit value per writable register.
+ */
+typedef struct
+{
+    uint16_t config; /*!< CONFIG register value. */
+    uint16_t tlow;   /*!< TLOW register value. */
+    uint16_t thigh;  /*!< THIGH register value. */
+} p3t1085_config_t;
+
+/*! @brief Build a ::p3t1085_config_t at compile time from the driver enums and thresholds in Celsius. */
+#define P3T1085_CONFIG_INIT(eCRate, eMode, eThermoStat, ePol, eHyst, tLowCel, tHighCel)          \
+    {                                                                                          \
+        .config = P3T1085UK_CONFIG_VALUE((eCRate), (eMode), (eThermoStat), (ePol), (eHyst)),   \
+        .tlow = P3T1085UK_TEMP_REG_VALUE(tLowCel), .thigh = P3T1085UK_TEMP_REG_VALUE(tHighCel) \
+    }
+
 enum EThermoStatMode
 {
     P3T1085UK_TS_COMP = 0,            /*!< Comparator Mode. */
@@ -97,6 +114,18 @@ int32_t P3T1085_I2C_Initialize(p3t1085_i2c_sensorhandle_t *pSensorHandle, ARM_DR
  */
 int32_t P3T1085_I2C_WriteData(p3t1085_i2c_sensorhandle_t *pSensorHandle, const registerwritelist_t *pRegWriteList);
 
+/*! @brief       The interface function to write 16-bit register data in the sensor.
+ *  @details     This function write the sensor with data in the 16-bit register pair array.
+ *               Masked entries are updated with read-modify-write, unmasked entries are overwritten.
+ *  @param[in]   pSensorHandle handle to the sensor.
+ *  @param[in]   pRegWriteList pointer to the register list.
+ *  @constraints This can be called any number of times only after P3T1085_I2C_Initialize().
+ *               Application has to ensure that previous instances of these APIs have exited before invocation.
+ *  @reeentrant  No
+ *  @return      ::P3T1085_I2C_WriteData16() returns the status .
+ */
+int32_t P3T1085_I2C_WriteData16(p3t1085_i2c_sensorhandle_t *pSensorHandle, const registerwritelist16_t *pRegWriteList);
+
 /*! @brief       The interface function to read the sensor data.
  *  @details     This function read the sensor data out from the device and returns raw data in a byte stream.
  *  @param[in]   pSensorHandle handle to the sensor.
@@ -121,6 +150,44 @@ int32_t P3T1085_I2C_ReadData(p3t1085_i2c_sensorhandle_t *pSensorHandle, const re
  */
 int32_t P3T1085_I2C_GetTemp(p3t1085_i2c_sensorhandle_t *pSensorHandle, float *pBuffer);
 
+/*! @brief       The interface function to get the fixed-point temperature of the sensor.
+ *  @details     This function read the temperature of sensor device and returns it in 1/16 celsius units,
+ *               without any floating point conversion.
+ *  @param[in]   pSensorHandle handle to the sensor.
+ *  @param[out]  pBuffer       handle to the output buffer
+ *  @constraints None
+ *               Application has to ensure that previous instances of these APIs have exited before invocation.
+ *  @reeentrant  No
+ *  @return      ::P3T1085_I2C_GetTempQ4() returns the status .
+ */
+int32_t P3T1085_I2C_GetTempQ4(p3t1085_i2c_sensorhandle_t *pSensorHandle, int16_t *pBuffer);
+
+/*! @brief       The interface function to start reading the temperature without waiting.
+ *  @details     This function starts the read of the Temp register and returns immediately,
+ *               the callback is called from the I2C interrupt when pRaw holds the register value.
+ *               Convert it with P3T1085_I2C_TempRawToQ4().
+ *  @param[in]   pSensorHandle handle to the sensor.
+ *  @param[out]  pRaw          buffer of P3T1085UK_REG_SIZE_BYTES, valid until the callback.
+ *  @param[in]   callback      the completion callback.
+ *  @param[in]   pUserData     pointer passed to the callback.
+ *  @constraints None
+ *  @reeentrant  Yes, it may be called from interrupt context.
+ *  @return      ::P3T1085_I2C_StartTempRead() returns the status, SENSOR_ERROR_BUSY while the bus is in use.
+ */
+int32_t P3T1085_I2C_StartTempRead(p3t1085_i2c_sensorhandle_t *pSensorHandle,
+                                  uint8_t *pRaw,
+                                  registerAsyncCallback_t callback,
+                                  void *pUserData);
+
+/*! @brief       The interface function to convert a raw Temp register value.
+ *  @details     This function converts the two register bytes into 1/16 celsius units.
+ *  @param[in]   pRaw the register bytes, MSB first.
+ *  @constraints None
+ *  @reeentrant  Yes
+ *  @return      ::P3T1085_I2C_TempRawToQ4() returns the temperature.
+ */
+int16_t P3T1085_I2C_TempRawToQ4(const uint8_t *pRaw);
+
 /*! @brief       The interface function to set the high limit Temperature of the sensor.
  *  @details     This function write the temperature into high limit temperature register of sensor device.
  *  @param[in]   pSensorHandle handle to the sensor.
@@ -274,4 +341,17 @@ int32_t P3T1085_I2C_GetPolarity(p3t1085_i2c_sensorhandle_t *pSensorHandle, enum
  *  @return      ::P3T1085_I2C_GetConversionRate() returns the status .
  */
 int32_t P3T1085_I2C_GetConversionRate(p3t1085_i2c_sensorhandle_t *pSensorHandle, enum ECRate * pBuffer);
+
+/*! @brief       The interface function to apply a complete configuration to the sensor.
+ *  @details     This function writes TLOW, THIGH and then CONFIG with one 2-byte write per register,
+ *               without read-modify-write, and reads all three back to verify them.
+ *               The thresholds are written first so the new mode never compares against stale limits.
+ *  @param[in]   pSensorHandle handle to the sensor.
+ *  @param[in]   pConfig       configuration built with P3T1085_CONFIG_INIT().
+ *  @constraints None
+ *               Application has to ensure that previous instances of these APIs have exited before invocation.
+ *  @reeentrant  No
+ *  @return      ::P3T1085_I2C_Configure() returns the status, SENSOR_ERROR_WRITE if a register does not read back as written.
+ */
+int32_t P3T1085_I2C_Configure(p3t1085_i2c_sensorhandle_t *pSensorHandle, const p3t1085_config_t *pConfig);
 #endif // P3T1085_UK_H_
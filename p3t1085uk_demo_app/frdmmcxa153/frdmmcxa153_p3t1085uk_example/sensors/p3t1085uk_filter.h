@@ -0,0 +1,140 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file p3t1085uk_filter.h
+ * @brief The p3t1085uk_filter.h file describes the P3T1085UK temperature filter chain.
+
+    A chain runs every reading of one sensor through up to P3T1085_FILTER_MAX_STAGES stages in
+    order: a median of N rejects single sample spikes, a first-order IIR low-pass smooths with
+    an exponential time constant, a boxcar averages the last N readings. The coefficients are
+    computed once when the chain is initialized, a reading then costs a few integer operations
+    per stage, all in 1/16 celsius units with extra fractional bits inside the IIR. The first
+    reading fills every stage, so the output starts without a settling ramp.
+*/
+
+#ifndef P3T1085UK_FILTER_H_
+#define P3T1085UK_FILTER_H_
+
+/* Standard C Includes */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* ISSDK Includes */
+#include "p3t1085uk_drv.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief Maximum number of stages of a chain. */
+#ifndef P3T1085_FILTER_MAX_STAGES
+#define P3T1085_FILTER_MAX_STAGES 4
+#endif
+
+/*! @brief Maximum number of readings of a median or boxcar stage. */
+#ifndef P3T1085_FILTER_MAX_LENGTH
+#define P3T1085_FILTER_MAX_LENGTH 16
+#endif
+
+/*! @brief Stage configurations, the IIR coefficient is T / (tau + T) in Q15 for a sample period
+ *         T and a time constant tau in the same unit. */
+#define P3T1085_FILTER_MEDIAN(length) {P3T1085_FILTER_TYPE_MEDIAN, (length)}
+#define P3T1085_FILTER_BOXCAR(length) {P3T1085_FILTER_TYPE_BOXCAR, (length)}
+#define P3T1085_FILTER_IIR(period, tau) \
+    {P3T1085_FILTER_TYPE_IIR, (uint16_t)((32768U * (period) + ((tau) + (period)) / 2U) / ((tau) + (period)))}
+
+enum EFilterType
+{
+    P3T1085_FILTER_TYPE_MEDIAN = 0, /*!< Median of the last readings, use an odd length. */
+    P3T1085_FILTER_TYPE_IIR = 1,    /*!< First-order low-pass. */
+    P3T1085_FILTER_TYPE_BOXCAR = 2, /*!< Mean of the last readings. */
+};
+
+/*!
+ * @brief This defines the configuration of a stage.
+ */
+typedef struct
+{
+    enum EFilterType type;
+    uint16_t param; /*!< Number of readings, or the IIR coefficient in Q15 (1 to 32768). */
+} p3t1085_filter_stage_config_t;
+
+/*!
+ * @brief This defines the state of a stage.
+ */
+typedef struct
+{
+    enum EFilterType type;
+    uint8_t length;                              /*!< Readings of a median or boxcar. */
+    uint8_t next;                                /*!< Oldest reading in history. */
+    uint32_t coeff;                              /*!< IIR coefficient in Q15, boxcar 1/length in Q24. */
+    int32_t acc;                                 /*!< IIR output with 8 more fractional bits, boxcar sum. */
+    int16_t history[P3T1085_FILTER_MAX_LENGTH];  /*!< Last readings, oldest at next. */
+    int16_t sorted[P3T1085_FILTER_MAX_LENGTH];   /*!< Last readings in ascending order, median only. */
+} p3t1085_filter_stage_t;
+
+/*!
+ * @brief This defines the filter chain of one sensor.
+ */
+typedef struct
+{
+    p3t1085_i2c_sensorhandle_t *pSensorHandle;
+    uint8_t stageCount;
+    bool primed;                                 /*!< The stages hold a reading. */
+    p3t1085_filter_stage_t stages[P3T1085_FILTER_MAX_STAGES];
+} p3t1085_filter_t;
+
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+/*! @brief       The interface function to initialize a filter chain.
+ *  @details     This function checks the stages and precomputes their coefficients.
+ *  @param[in]   pFilter        the filter chain.
+ *  @param[in]   pSensorHandle  handle to the sensor read by P3T1085_Filter_GetTempQ4().
+ *  @param[in]   pStages        the stages, in processing order.
+ *  @param[in]   stageCount     the number of stages, 1 to P3T1085_FILTER_MAX_STAGES.
+ *  @constraints None
+ *  @reeentrant  No
+ *  @return      ::P3T1085_Filter_Init() returns the status .
+ */
+int32_t P3T1085_Filter_Init(p3t1085_filter_t *pFilter,
+                            p3t1085_i2c_sensorhandle_t *pSensorHandle,
+                            const p3t1085_filter_stage_config_t *pStages,
+                            uint8_t stageCount);
+
+/*! @brief       The interface function to restart a filter chain.
+ *  @details     The next reading fills every stage again, for example after a gap in the stream.
+ *  @param[in]   pFilter  the filter chain.
+ *  @constraints None
+ *  @reeentrant  No
+ *  @return      void.
+ */
+void P3T1085_Filter_Reset(p3t1085_filter_t *pFilter);
+
+/*! @brief       The interface function to filter a reading.
+ *  @details     This function may be fed from any acquisition path, for example an ALERT read.
+ *  @param[in]   pFilter  the filter chain.
+ *  @param[in]   tempQ4   the temperature.
+ *  @constraints None
+ *  @reeentrant  No
+ *  @return      ::P3T1085_Filter_Process() returns the filtered temperature.
+ */
+int16_t P3T1085_Filter_Process(p3t1085_filter_t *pFilter, int16_t tempQ4);
+
+/*! @brief       The interface function to read the temperature through the filter chain.
+ *  @details     This function reads the Temp register like P3T1085_I2C_GetTempQ4() and filters it,
+ *               the filtered value costs the same bus transfer as the raw one.
+ *  @param[in]   pFilter       the filter chain.
+ *  @param[out]  pRawQ4        the temperature read, may be NULL.
+ *  @param[out]  pFilteredQ4   the filtered temperature.
+ *  @constraints This can be called any number of times only after P3T1085_I2C_Initialize().
+ *               Application has to ensure that previous instances of these APIs have exited before invocation.
+ *  @reeentrant  No
+ *  @return      ::P3T1085_Filter_GetTempQ4() returns the status, the chain is left unchanged when the read fails.
+ */
+int32_t P3T1085_Filter_GetTempQ4(p3t1085_filter_t *pFilter, int16_t *pRawQ4, int16_t *pFilteredQ4);
+
+#endif /* P3T1085UK_FILTER_H_ */
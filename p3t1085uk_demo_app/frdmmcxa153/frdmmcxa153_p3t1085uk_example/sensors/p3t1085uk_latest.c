@@ -0,0 +1,70 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file p3t1085uk_latest.c
+ * @brief The p3t1085uk_latest.c file implements the sequence locked latest reading of a P3T1085UK sensor.
+ */
+
+//-----------------------------------------------------------------------
+// ISSDK Includes
+//-----------------------------------------------------------------------
+#include "fsl_common.h"
+#include "sensor_drv.h"
+#include "p3t1085uk_latest.h"
+#include "sensor_no_heap.h"
+
+//-----------------------------------------------------------------------
+// Functions
+//-----------------------------------------------------------------------
+SENSOR_RAMFUNC void P3T1085_Latest_Publish(p3t1085_latest_t *pLatest,
+                                           int16_t tempQ4,
+                                           int32_t status,
+                                           uint32_t timestamp)
+{
+    uint32_t sequence = pLatest->sequence;
+
+    /* The odd sequence must be visible before any field changes. */
+    pLatest->sequence = sequence + 1U;
+    __DMB();
+
+    pLatest->tempQ4 = tempQ4;
+    pLatest->status = status;
+    pLatest->timestamp = timestamp;
+
+    /* And the fields before the even sequence which publishes them. */
+    __DMB();
+    pLatest->sequence = sequence + 2U;
+}
+
+int32_t P3T1085_Latest_Read(const p3t1085_latest_t *pLatest, p3t1085_reading_t *pReading)
+{
+    uint32_t sequence;
+
+    for (uint32_t attempt = 0; attempt < P3T1085_LATEST_READ_RETRIES; attempt++)
+    {
+        sequence = pLatest->sequence;
+        if (0U != (sequence & 1U))
+        {
+            continue;
+        }
+        __DMB();
+
+        pReading->tempQ4 = pLatest->tempQ4;
+        pReading->status = pLatest->status;
+        pReading->timestamp = pLatest->timestamp;
+
+        /* The copy is consistent if no publication started meanwhile. */
+        __DMB();
+        if (pLatest->sequence == sequence)
+        {
+            pReading->sequence = sequence;
+            return (0U == sequence) ? SENSOR_ERROR_INIT : SENSOR_ERROR_NONE;
+        }
+    }
+
+    return SENSOR_ERROR_BUSY;
+}
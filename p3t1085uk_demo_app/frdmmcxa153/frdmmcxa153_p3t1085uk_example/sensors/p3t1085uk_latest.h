@@ -0,0 +1,83 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file p3t1085uk_latest.h
+ * @brief The p3t1085uk_latest.h file describes the latest reading publication of a P3T1085UK sensor.
+
+    A slot holds the last temperature, status and timestamp of one sensor under a sequence lock.
+    The writer never waits: it makes the sequence odd, stores the reading and makes it even again.
+    A reader copies the reading and keeps it only if the sequence was even and unchanged around
+    the copy, so readers never block the writer. Each slot must have a single writer, for example
+    one interrupt or one core. Slots shared between cores or with DMA are defined in non-cacheable
+    RAM with AT_NONCACHEABLE_SECTION().
+*/
+
+#ifndef P3T1085UK_LATEST_H_
+#define P3T1085UK_LATEST_H_
+
+/* Standard C Includes */
+#include <stdint.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief Copy attempts of a reader before it gives up, a reader preempting the writer of
+ *         the slot on the same core could otherwise never complete. */
+#ifndef P3T1085_LATEST_READ_RETRIES
+#define P3T1085_LATEST_READ_RETRIES 4U
+#endif
+
+/*!
+ * @brief This defines a reading taken from a slot.
+ */
+typedef struct
+{
+    uint32_t sequence;  /*!< Even sequence of the reading, it changes with every publication. */
+    uint32_t timestamp; /*!< Time of the reading, in the unit chosen by the writer. */
+    int32_t status;     /*!< Status of the read, tempQ4 is only valid for SENSOR_ERROR_NONE. */
+    int16_t tempQ4;     /*!< Temperature in 1/16 celsius units. */
+} p3t1085_reading_t;
+
+/*!
+ * @brief This defines the slot of one sensor, zero initialized before use.
+ */
+typedef struct
+{
+    volatile uint32_t sequence; /*!< Odd while the writer updates the slot. */
+    volatile uint32_t timestamp;
+    volatile int32_t status;
+    volatile int16_t tempQ4;
+} p3t1085_latest_t;
+
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+/*! @brief       The interface function to publish the latest reading of a sensor.
+ *  @details     This function completes in constant time whatever the readers do.
+ *  @param[in]   pLatest   the slot of the sensor.
+ *  @param[in]   tempQ4    the temperature.
+ *  @param[in]   status    the status of the read.
+ *  @param[in]   timestamp the time of the reading.
+ *  @constraints Only one writer per slot.
+ *  @reeentrant  Yes, for different slots.
+ *  @return      void.
+ */
+void P3T1085_Latest_Publish(p3t1085_latest_t *pLatest, int16_t tempQ4, int32_t status, uint32_t timestamp);
+
+/*! @brief       The interface function to take a consistent snapshot of the latest reading.
+ *  @details     This function retries the copy while the writer updates the slot, up to
+ *               P3T1085_LATEST_READ_RETRIES times. A new reading has a different sequence.
+ *  @param[in]   pLatest   the slot of the sensor.
+ *  @param[out]  pReading  the reading.
+ *  @constraints None
+ *  @reeentrant  Yes, it may be called from interrupt context or another core.
+ *  @return      ::P3T1085_Latest_Read() returns the status, SENSOR_ERROR_INIT when nothing was published
+ *               yet and SENSOR_ERROR_BUSY when the writer kept updating the slot.
+ */
+int32_t P3T1085_Latest_Read(const p3t1085_latest_t *pLatest, p3t1085_reading_t *pReading);
+
+#endif /* P3T1085UK_LATEST_H_ */
@@ -0,0 +1,173 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file p3t1085uk_snapshot.c
+ * @brief The p3t1085uk_snapshot.c file implements the P3T1085UK configuration snapshot.
+ */
+
+//-----------------------------------------------------------------------
+// Standard C Includes
+//-----------------------------------------------------------------------
+#include <stddef.h>
+#include <string.h>
+
+//-----------------------------------------------------------------------
+// ISSDK Includes
+//-----------------------------------------------------------------------
+#include "p3t1085uk.h"
+#include "p3t1085uk_crc.h"
+#include "p3t1085uk_snapshot.h"
+#include "sensor_no_heap.h"
+
+//-----------------------------------------------------------------------
+// Functions
+//-----------------------------------------------------------------------
+static uint32_t P3T1085_Snapshot_Checksum(const p3t1085_snapshot_t *pSnapshot)
+{
+    return P3T1085_Crc32(0U, (const uint8_t *)pSnapshot, (uint32_t)offsetof(p3t1085_snapshot_t, crc));
+}
+
+static int32_t P3T1085_Snapshot_Read(p3t1085_i2c_sensorhandle_t *pSensorHandle, uint16_t *pValues)
+{
+    int32_t status;
+    uint8_t reg[P3T1085_SNAPSHOT_REG_COUNT * P3T1085UK_REG_SIZE_BYTES];
+    const registerreadlist_t readList[] = {{.readFrom = P3T1085UK_TLOW, .numBytes = P3T1085UK_REG_SIZE_BYTES},
+                                           {.readFrom = P3T1085UK_THIGH, .numBytes = P3T1085UK_REG_SIZE_BYTES},
+                                           {.readFrom = P3T1085UK_CONFIG, .numBytes = P3T1085UK_REG_SIZE_BYTES},
+                                           __END_READ_DATA__};
+
+    if (pSensorHandle->isInitialized != true)
+    {
+        return SENSOR_ERROR_INIT;
+    }
+
+    status = Sensor_I2C_ReadCoalesced(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo, pSensorHandle->slaveAddress,
+                                      readList, P3T1085UK_BYTES_PER_ADDRESS, reg);
+    if (SENSOR_ERROR_NONE != status)
+    {
+        return SENSOR_ERROR_READ;
+    }
+    for (uint32_t i = 0; i < P3T1085_SNAPSHOT_REG_COUNT; i++)
+    {
+        pValues[i] = (uint16_t)((uint16_t)reg[2U * i] << 8) | (uint16_t)reg[2U * i + 1U];
+    }
+
+    return SENSOR_ERROR_NONE;
+}
+
+void P3T1085_Snapshot_Init(p3t1085_snapshot_t *pSnapshot, uint32_t busSpeed)
+{
+    memset(pSnapshot, 0, sizeof(*pSnapshot));
+    pSnapshot->magic = P3T1085_SNAPSHOT_MAGIC;
+    pSnapshot->version = P3T1085_SNAPSHOT_VERSION;
+    pSnapshot->busSpeed = busSpeed;
+    pSnapshot->crc = P3T1085_Snapshot_Checksum(pSnapshot);
+}
+
+bool P3T1085_Snapshot_IsValid(const p3t1085_snapshot_t *pSnapshot)
+{
+    return (pSnapshot != NULL) && (pSnapshot->magic == P3T1085_SNAPSHOT_MAGIC) &&
+           (pSnapshot->version == P3T1085_SNAPSHOT_VERSION) &&
+           (pSnapshot->sensorCount <= P3T1085_SNAPSHOT_MAX_SENSORS) &&
+           (pSnapshot->crc == P3T1085_Snapshot_Checksum(pSnapshot));
+}
+
+int32_t P3T1085_Snapshot_Set(p3t1085_snapshot_t *pSnapshot,
+                             uint32_t slot,
+                             const p3t1085_i2c_sensorhandle_t *pSensorHandle,
+                             const p3t1085_config_t *pConfig)
+{
+    p3t1085_snapshot_sensor_t *pSensor;
+
+    /*! Check the input parameters. */
+    if ((pSnapshot == NULL) || (pSensorHandle == NULL) || (pConfig == NULL) ||
+        (slot >= P3T1085_SNAPSHOT_MAX_SENSORS) || (slot > pSnapshot->sensorCount))
+    {
+        return SENSOR_ERROR_INVALID_PARAM;
+    }
+
+    pSensor = &pSnapshot->sensors[slot];
+    pSensor->busIndex = pSensorHandle->deviceInfo.deviceInstance;
+    pSensor->reserved = 0U;
+    pSensor->slaveAddress = pSensorHandle->slaveAddress;
+    pSensor->config.config = (uint16_t)(pConfig->config & ~P3T1085UK_CONFIG_RO_MASK);
+    pSensor->config.tlow = pConfig->tlow;
+    pSensor->config.thigh = pConfig->thigh;
+    if (slot == pSnapshot->sensorCount)
+    {
+        pSnapshot->sensorCount++;
+    }
+    pSnapshot->saveCount++;
+    pSnapshot->crc = P3T1085_Snapshot_Checksum(pSnapshot);
+
+    return SENSOR_ERROR_NONE;
+}
+
+int32_t P3T1085_Snapshot_Capture(p3t1085_snapshot_t *pSnapshot,
+                                 uint32_t slot,
+                                 p3t1085_i2c_sensorhandle_t *pSensorHandle)
+{
+    int32_t status;
+    uint16_t values[P3T1085_SNAPSHOT_REG_COUNT];
+    p3t1085_config_t config;
+
+    if (pSensorHandle == NULL)
+    {
+        return SENSOR_ERROR_INVALID_PARAM;
+    }
+
+    status = P3T1085_Snapshot_Read(pSensorHandle, values);
+    if (SENSOR_ERROR_NONE != status)
+    {
+        return status;
+    }
+    config.tlow = values[0];
+    config.thigh = values[1];
+    config.config = values[2];
+
+    return P3T1085_Snapshot_Set(pSnapshot, slot, pSensorHandle, &config);
+}
+
+int32_t P3T1085_Snapshot_Apply(const p3t1085_snapshot_t *pSnapshot,
+                               uint32_t slot,
+                               p3t1085_i2c_sensorhandle_t *pSensorHandle)
+{
+    int32_t status;
+    registerwritelist16_t writeList[P3T1085_SNAPSHOT_REG_COUNT + 1U];
+    const p3t1085_snapshot_sensor_t *pSensor;
+
+    /*! Check the input parameters and the image. */
+    if ((pSensorHandle == NULL) || !P3T1085_Snapshot_IsValid(pSnapshot) || (slot >= pSnapshot->sensorCount))
+    {
+        return SENSOR_ERROR_INVALID_PARAM;
+    }
+    pSensor = &pSnapshot->sensors[slot];
+    if ((pSensor->slaveAddress != pSensorHandle->slaveAddress) ||
+        (pSensor->busIndex != pSensorHandle->deviceInfo.deviceInstance))
+    {
+        return SENSOR_ERROR_BAD_ADDRESS;
+    }
+
+    if (pSensorHandle->isInitialized != true)
+    {
+        return SENSOR_ERROR_INIT;
+    }
+
+    /*! The image passed its CRC, its registers are written in one write list without read. */
+    writeList[0] = (registerwritelist16_t){.writeTo = P3T1085UK_TLOW, .value = pSensor->config.tlow, .mask = 0};
+    writeList[1] = (registerwritelist16_t){.writeTo = P3T1085UK_THIGH, .value = pSensor->config.thigh, .mask = 0};
+    writeList[2] = (registerwritelist16_t){.writeTo = P3T1085UK_CONFIG, .value = pSensor->config.config, .mask = 0};
+    writeList[3] = (registerwritelist16_t)__END_WRITE_DATA__;
+    status = Sensor_I2C_Write16(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo, pSensorHandle->slaveAddress,
+                                writeList, P3T1085UK_BYTES_PER_ADDRESS);
+    if (SENSOR_ERROR_NONE != status)
+    {
+        return SENSOR_ERROR_WRITE;
+    }
+
+    return SENSOR_ERROR_NONE;
+}
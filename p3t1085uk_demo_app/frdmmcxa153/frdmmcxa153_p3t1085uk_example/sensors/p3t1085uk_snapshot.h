@@ -0,0 +1,135 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file p3t1085uk_snapshot.h
+ * @brief The p3t1085uk_snapshot.h file describes the P3T1085UK configuration snapshot.
+
+    A snapshot is a self-checked image of the sensor setup: the bus speed, then the bus index,
+    slave address and CONFIG, TLOW and THIGH values of each sensor, closed by a CRC-32. The
+    application keeps it where it survives a reset, for example in a .noinit RAM section for
+    warm restarts or in flash, and updates it when a setting changes.
+
+    At boot a valid image replaces the defaults: its CRC is trusted, so each sensor gets one
+    write list of its three registers and no read, and the caches of the other modules (alarm,
+    rate, window) are seeded from it instead of from bus reads. An image failing its check is
+    ignored and the defaults are applied as on a cold boot.
+*/
+
+#ifndef P3T1085UK_SNAPSHOT_H_
+#define P3T1085UK_SNAPSHOT_H_
+
+/* Standard C Includes */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* ISSDK Includes */
+#include "p3t1085uk_drv.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief Maximum number of sensors of a snapshot. */
+#ifndef P3T1085_SNAPSHOT_MAX_SENSORS
+#define P3T1085_SNAPSHOT_MAX_SENSORS 4
+#endif
+
+/*! @brief Image identification, the version changes with the layout. */
+#define P3T1085_SNAPSHOT_MAGIC   (0x53543350U) /* "P3TS" */
+#define P3T1085_SNAPSHOT_VERSION (1U)
+
+/*! @brief Registers of a sensor kept by a snapshot: TLOW, THIGH and CONFIG. */
+#define P3T1085_SNAPSHOT_REG_COUNT (3U)
+
+/*!
+ * @brief This defines the snapshot of one sensor.
+ */
+typedef struct
+{
+    uint8_t busIndex;             /*!< Bus index given to P3T1085_I2C_Initialize(). */
+    uint8_t reserved;
+    uint16_t slaveAddress;        /*!< I2C address of the sensor. */
+    p3t1085_config_t config;      /*!< Register values. */
+} p3t1085_snapshot_sensor_t;
+
+/*!
+ * @brief This defines the snapshot image.
+ */
+typedef struct
+{
+    uint32_t magic;               /*!< P3T1085_SNAPSHOT_MAGIC. */
+    uint16_t version;             /*!< P3T1085_SNAPSHOT_VERSION. */
+    uint16_t sensorCount;         /*!< Sensors of the image. */
+    uint32_t busSpeed;            /*!< ARM_I2C_BUS_SPEED_x of the sensor bus. */
+    uint32_t saveCount;           /*!< Updates since the image was created. */
+    p3t1085_snapshot_sensor_t sensors[P3T1085_SNAPSHOT_MAX_SENSORS];
+    uint32_t crc;                 /*!< CRC-32 of the fields above. */
+} p3t1085_snapshot_t;
+
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+/*! @brief       The interface function to start a valid image without sensor.
+ *  @param[in]   pSnapshot  the image.
+ *  @param[in]   busSpeed   the ARM_I2C_BUS_SPEED_x of the sensor bus.
+ *  @constraints None
+ *  @reeentrant  No
+ *  @return      void.
+ */
+void P3T1085_Snapshot_Init(p3t1085_snapshot_t *pSnapshot, uint32_t busSpeed);
+
+/*! @brief       The interface function to check an image.
+ *  @param[in]   pSnapshot  the image, for example left in RAM by the last reset.
+ *  @constraints None
+ *  @reeentrant  Yes
+ *  @return      ::P3T1085_Snapshot_IsValid() returns true when the identification, the sensor count and the CRC are right.
+ */
+bool P3T1085_Snapshot_IsValid(const p3t1085_snapshot_t *pSnapshot);
+
+/*! @brief       The interface function to store the configuration of a sensor.
+ *  @param[in]   pSnapshot      the image.
+ *  @param[in]   slot           the sensor, up to the sensor count to add one.
+ *  @param[in]   pSensorHandle  handle to the sensor, gives the bus index and address.
+ *  @param[in]   pConfig        the register values.
+ *  @constraints None
+ *  @reeentrant  No
+ *  @return      ::P3T1085_Snapshot_Set() returns the status .
+ */
+int32_t P3T1085_Snapshot_Set(p3t1085_snapshot_t *pSnapshot,
+                             uint32_t slot,
+                             const p3t1085_i2c_sensorhandle_t *pSensorHandle,
+                             const p3t1085_config_t *pConfig);
+
+/*! @brief       The interface function to store the registers of a sensor as they are.
+ *  @details     This function reads CONFIG, TLOW and THIGH, so it follows every way they
+ *               may have been changed. The alert flags of CONFIG are not kept.
+ *  @param[in]   pSnapshot      the image.
+ *  @param[in]   slot           the sensor, up to the sensor count to add one.
+ *  @param[in]   pSensorHandle  handle to the sensor.
+ *  @constraints Application has to ensure that previous instances of the sensor APIs have exited before invocation.
+ *  @reeentrant  No
+ *  @return      ::P3T1085_Snapshot_Capture() returns the status .
+ */
+int32_t P3T1085_Snapshot_Capture(p3t1085_snapshot_t *pSnapshot,
+                                 uint32_t slot,
+                                 p3t1085_i2c_sensorhandle_t *pSensorHandle);
+
+/*! @brief       The interface function to apply the configuration of a sensor.
+ *  @details     This function writes the P3T1085_SNAPSHOT_REG_COUNT registers of the image in
+ *               one write list, without read before or after: the image CRC stands for it.
+ *  @param[in]   pSnapshot      the image, checked first.
+ *  @param[in]   slot           the sensor.
+ *  @param[in]   pSensorHandle  handle to the sensor, initialized with the address of the image.
+ *  @constraints Application has to ensure that previous instances of the sensor APIs have exited before invocation.
+ *  @reeentrant  No
+ *  @return      ::P3T1085_Snapshot_Apply() returns the status, SENSOR_ERROR_INVALID_PARAM for an invalid
+ *               image or slot and SENSOR_ERROR_BAD_ADDRESS when the handle is not the sensor of the slot.
+ */
+int32_t P3T1085_Snapshot_Apply(const p3t1085_snapshot_t *pSnapshot,
+                               uint32_t slot,
+                               p3t1085_i2c_sensorhandle_t *pSensorHandle);
+
+#endif /* P3T1085UK_SNAPSHOT_H_ */
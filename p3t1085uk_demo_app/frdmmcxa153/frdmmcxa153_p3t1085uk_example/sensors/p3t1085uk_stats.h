@@ -0,0 +1,154 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file p3t1085uk_stats.h
+ * @brief The p3t1085uk_stats.h file describes the running statistics of a P3T1085UK sensor.
+
+    The statistics summarize the sample stream of one sensor over tumbling windows, by default
+    1 second, 1 minute and 1 hour, so only the count, minimum, maximum, mean and variance of a
+    window have to leave the device. A window keeps integer sums of the deviations from its first
+    sample: the update is a subtract, a multiply and three adds whatever the window length, the
+    deviations stay small so the sums are exact and do not cancel like plain sums of squares, and
+    the mean and variance are only derived when a window is queried. The memory is fixed by
+    P3T1085_STATS_WINDOW_COUNT, each object registers under its sensor handle.
+*/
+
+#ifndef P3T1085UK_STATS_H_
+#define P3T1085UK_STATS_H_
+
+/* Standard C Includes */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* ISSDK Includes */
+#include "p3t1085uk_drv.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief Maximum number of sensors with statistics. */
+#ifndef P3T1085_STATS_MAX_SENSORS
+#define P3T1085_STATS_MAX_SENSORS 4
+#endif
+
+/*! @brief Default window lengths in milliseconds. */
+#define P3T1085_STATS_1S_MS   (1000U)
+#define P3T1085_STATS_1MIN_MS (60U * P3T1085_STATS_1S_MS)
+#define P3T1085_STATS_1H_MS   (60U * P3T1085_STATS_1MIN_MS)
+
+enum EStatsWindow
+{
+    P3T1085_STATS_WINDOW_SHORT = 0,  /*!< 1 second by default. */
+    P3T1085_STATS_WINDOW_MEDIUM = 1, /*!< 1 minute by default. */
+    P3T1085_STATS_WINDOW_LONG = 2,   /*!< 1 hour by default. */
+    P3T1085_STATS_WINDOW_COUNT = 3,
+};
+
+/*!
+ * @brief This defines the statistics of one window, all temperatures are in 1/16 celsius units.
+ */
+typedef struct
+{
+    uint32_t startMs;    /*!< Start of the window. */
+    uint32_t count;      /*!< Samples in the window, the other fields are only valid when not 0. */
+    int16_t minQ4;       /*!< Lowest sample. */
+    int16_t maxQ4;       /*!< Highest sample. */
+    int16_t meanQ4;      /*!< Mean, rounded to the nearest step. */
+    uint32_t varianceQ8; /*!< Population variance in 1/256 celsius^2 units, rounded. */
+} p3t1085_stats_result_t;
+
+/*!
+ * @brief This defines the sums of the window in progress.
+ */
+typedef struct
+{
+    uint32_t count;
+    int16_t refQ4;    /*!< First sample, the sums are taken over the deviations from it. */
+    int16_t minQ4;
+    int16_t maxQ4;
+    int64_t sum;      /*!< Sum of the deviations. */
+    uint64_t sumSq;   /*!< Sum of the squared deviations. */
+} p3t1085_stats_sums_t;
+
+/*!
+ * @brief This defines one tumbling window.
+ */
+typedef struct
+{
+    uint32_t lengthMs;             /*!< Window length. */
+    uint32_t startMs;              /*!< Start of the window in progress. */
+    p3t1085_stats_sums_t sums;     /*!< Window in progress. */
+    p3t1085_stats_result_t last;   /*!< Last complete window. */
+    bool complete;                 /*!< A window has completed, last is valid. */
+} p3t1085_stats_window_t;
+
+/*!
+ * @brief This defines the statistics of one sensor.
+ */
+typedef struct
+{
+    const p3t1085_i2c_sensorhandle_t *pSensorHandle;
+    bool started;                  /*!< The windows start with the first sample. */
+    p3t1085_stats_window_t windows[P3T1085_STATS_WINDOW_COUNT];
+} p3t1085_stats_t;
+
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+/*! @brief       The interface function to initialize the statistics of a sensor.
+ *  @details     This function clears the windows and registers the statistics under the sensor
+ *               handle, a handle registered before is moved to the new statistics.
+ *  @param[in]   pStats         the statistics.
+ *  @param[in]   pSensorHandle  handle to the sensor.
+ *  @param[in]   pWindowMs      P3T1085_STATS_WINDOW_COUNT window lengths in milliseconds, shortest
+ *                              first, or NULL for 1 second, 1 minute and 1 hour.
+ *  @constraints None
+ *  @reeentrant  No
+ *  @return      ::P3T1085_Stats_Init() returns the status .
+ */
+int32_t P3T1085_Stats_Init(p3t1085_stats_t *pStats,
+                           const p3t1085_i2c_sensorhandle_t *pSensorHandle,
+                           const uint32_t *pWindowMs);
+
+/*! @brief       The interface function to find the statistics of a sensor.
+ *  @param[in]   pSensorHandle  handle to the sensor.
+ *  @constraints None
+ *  @reeentrant  Yes
+ *  @return      ::P3T1085_Stats_Find() returns the statistics, NULL when none is registered.
+ */
+p3t1085_stats_t *P3T1085_Stats_Find(const p3t1085_i2c_sensorhandle_t *pSensorHandle);
+
+/*! @brief       The interface function to add a sample.
+ *  @details     This function closes every window the sample time has left, then adds the sample
+ *               to the windows in progress. It takes constant time and never accesses the bus.
+ *  @param[in]   pStats   the statistics.
+ *  @param[in]   tempQ4   the temperature.
+ *  @param[in]   timeMs   the time of the sample, it must not go back and may wrap.
+ *  @constraints Call P3T1085_Stats_Update() and P3T1085_Stats_Get() from the same context, or
+ *               lock out the updates around a query.
+ *  @reeentrant  No
+ *  @return      void.
+ */
+void P3T1085_Stats_Update(p3t1085_stats_t *pStats, int16_t tempQ4, uint32_t timeMs);
+
+/*! @brief       The interface function to read the statistics of a window.
+ *  @details     The last complete window has a count of 0 when no sample fell into it.
+ *  @param[in]   pStats   the statistics.
+ *  @param[in]   eWindow  the window.
+ *  @param[in]   running  true for the window in progress, false for the last complete one.
+ *  @param[out]  pResult  the statistics of the window.
+ *  @constraints See P3T1085_Stats_Update().
+ *  @reeentrant  No
+ *  @return      ::P3T1085_Stats_Get() returns the status, SENSOR_ERROR_INIT when no window of
+ *               that length has completed yet.
+ */
+int32_t P3T1085_Stats_Get(const p3t1085_stats_t *pStats,
+                          enum EStatsWindow eWindow,
+                          bool running,
+                          p3t1085_stats_result_t *pResult);
+
+#endif /* P3T1085UK_STATS_H_ */
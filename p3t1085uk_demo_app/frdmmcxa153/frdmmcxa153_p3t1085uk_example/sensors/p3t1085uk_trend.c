@@ -0,0 +1,173 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file p3t1085uk_trend.c
+ * @brief The p3t1085uk_trend.c file implements the P3T1085UK temperature trend detector.
+ */
+
+//-----------------------------------------------------------------------
+// ISSDK Includes
+//-----------------------------------------------------------------------
+#include "fsl_common.h"
+#include "sensor_drv.h"
+#include "p3t1085uk_trend.h"
+#include "sensor_no_heap.h"
+
+//-----------------------------------------------------------------------
+// Macros
+//-----------------------------------------------------------------------
+/* Times are scaled down until the window fits in 15 bits, which keeps every sum of the fit
+ * below 2^55 with 16 readings of 13 bits. */
+#define P3T1085_TREND_TIME_MAX (0x7FFFU)
+/* Slope of one 1/16 celsius step per millisecond in 1/1000 celsius per second. */
+#define P3T1085_TREND_MILLIC_PER_S (62500)
+
+//-----------------------------------------------------------------------
+// Functions
+//-----------------------------------------------------------------------
+/* Fit x = a + b * t through the window with t = 0 at the newest reading, then solve for THIGH:
+ *   n * Sxx * b = n * Sxy, n * Sxx * (THIGH - a) = THIGH * n * Sxx - sum(x) * Sxx + Sxy * sum(t). */
+static void P3T1085_Trend_Fit(p3t1085_trend_t *pTrend)
+{
+    uint8_t newest = (pTrend->next == 0U) ? (uint8_t)(pTrend->length - 1U) : (uint8_t)(pTrend->next - 1U);
+    uint32_t newestMs = pTrend->timeMs[newest];
+    uint32_t span = newestMs - pTrend->timeMs[pTrend->next];
+    int64_t n = (int64_t)pTrend->count;
+    int64_t st = 0;
+    int64_t sx = 0;
+    int64_t stt = 0;
+    int64_t stx = 0;
+    int64_t sxx;
+    int64_t sxy;
+    int64_t num;
+    int64_t den;
+    int64_t q;
+    uint8_t shift = 0U;
+    int32_t t;
+
+    while ((span >> shift) > P3T1085_TREND_TIME_MAX)
+    {
+        shift++;
+    }
+
+    for (uint8_t i = 0; i < pTrend->count; i++)
+    {
+        t = -(int32_t)((newestMs - pTrend->timeMs[i]) >> shift);
+        st += t;
+        sx += pTrend->tempQ4[i];
+        stt += (int64_t)t * t;
+        stx += (int64_t)t * pTrend->tempQ4[i];
+    }
+
+    sxx = n * stt - st * st;
+    sxy = n * stx - st * sx;
+    if (sxx <= 0)
+    {
+        /* Every reading at the same time, there is no slope. */
+        pTrend->slopeMilliCPerS = 0;
+        pTrend->timeToThresholdMs = P3T1085_TREND_NEVER;
+        return;
+    }
+    pTrend->slopeMilliCPerS = (int32_t)((sxy * P3T1085_TREND_MILLIC_PER_S) / (sxx << shift));
+
+    num = (int64_t)pTrend->tHighQ4 * n * sxx - sx * sxx + sxy * st;
+    den = n * sxy;
+    if (num <= 0)
+    {
+        pTrend->timeToThresholdMs = 0U;
+    }
+    else if (den <= 0)
+    {
+        pTrend->timeToThresholdMs = P3T1085_TREND_NEVER;
+    }
+    else
+    {
+        q = num / den;
+        pTrend->timeToThresholdMs =
+            (q >= (int64_t)(P3T1085_TREND_NEVER >> shift)) ? P3T1085_TREND_NEVER : ((uint32_t)q << shift);
+    }
+}
+
+int32_t P3T1085_Trend_Init(p3t1085_trend_t *pTrend,
+                           uint8_t length,
+                           int16_t tHighQ4,
+                           uint32_t horizonMs,
+                           p3t1085_trend_callback_t callback,
+                           void *pUserData)
+{
+    /*! Check the input parameters. */
+    if ((pTrend == NULL) || (length < 2U) || (length > P3T1085_TREND_MAX_LENGTH))
+    {
+        return SENSOR_ERROR_INVALID_PARAM;
+    }
+
+    pTrend->length = length;
+    pTrend->count = 0U;
+    pTrend->next = 0U;
+    pTrend->warning = false;
+    pTrend->tHighQ4 = tHighQ4;
+    pTrend->horizonMs = horizonMs;
+    pTrend->slopeMilliCPerS = 0;
+    pTrend->timeToThresholdMs = P3T1085_TREND_NEVER;
+    pTrend->callback = callback;
+    pTrend->pUserData = pUserData;
+
+    return SENSOR_ERROR_NONE;
+}
+
+void P3T1085_Trend_SetThreshold(p3t1085_trend_t *pTrend, int16_t tHighQ4)
+{
+    pTrend->tHighQ4 = tHighQ4;
+}
+
+void P3T1085_Trend_Update(p3t1085_trend_t *pTrend, int16_t tempQ4, uint32_t timeMs)
+{
+    bool warning;
+
+    pTrend->timeMs[pTrend->next] = timeMs;
+    pTrend->tempQ4[pTrend->next] = tempQ4;
+    pTrend->next = (pTrend->next + 1U == pTrend->length) ? 0U : (uint8_t)(pTrend->next + 1U);
+    if (pTrend->count < pTrend->length)
+    {
+        pTrend->count++;
+        if (pTrend->count < pTrend->length)
+        {
+            return;
+        }
+    }
+
+    P3T1085_Trend_Fit(pTrend);
+
+    warning = (pTrend->timeToThresholdMs <= pTrend->horizonMs);
+    if (warning != pTrend->warning)
+    {
+        pTrend->warning = warning;
+        if (pTrend->callback != NULL)
+        {
+            pTrend->callback(pTrend->pUserData, warning, pTrend->timeToThresholdMs);
+        }
+    }
+}
+
+int32_t P3T1085_Trend_Get(const p3t1085_trend_t *pTrend, int32_t *pSlopeMilliCPerS, uint32_t *pTimeToThresholdMs)
+{
+    /*! Check the input parameters. */
+    if ((pTrend == NULL) || (pSlopeMilliCPerS == NULL) || (pTimeToThresholdMs == NULL))
+    {
+        return SENSOR_ERROR_INVALID_PARAM;
+    }
+
+    if (pTrend->count < pTrend->length)
+    {
+        return SENSOR_ERROR_INIT;
+    }
+
+    *pSlopeMilliCPerS = pTrend->slopeMilliCPerS;
+    *pTimeToThresholdMs = pTrend->timeToThresholdMs;
+
+    return SENSOR_ERROR_NONE;
+}
@@ -34,6 +34,8 @@
 #include "issdk_hal.h"
 #include "gpio_driver.h"
 #include "p3t1085uk_drv.h"
+#include "p3t1085uk_window.h"
+#include "p3t1085uk_snapshot.h"
 #include "systick_utils.h"
 
 //-----------------------------------------------------------------------
@@ -46,16 +48,18 @@
 // Macros
 //-----------------------------------------------------------------------
 
-#define P3T1085_INT1_GPIO     GPIO0
-#define P3T1085_INT1_PIN      28U
-#define P3T1085_INT1_IRQ      GPIO0_IRQn
-#define P3T1085_INT1_ISR      GPIO0_IRQHandler
+#define P3T1085_INT1_GPIO     ALERT_GPIO
+#define P3T1085_INT1_PIN      ALERT_PIN
+#define P3T1085_INT1_IRQ      ALERT_IRQ
+#define P3T1085_INT1_ISR      ALERT_IRQ_HANDLER
+#define SENSOR_BUS_SPEED      ARM_I2C_BUS_SPEED_FAST /* Bus speed of a cold boot. */
 
 // Constants
 //-----------------------------------------------------------------------
-/*! @brief Register settings for Interrupt (non buffered) mode. */
-const registerwritelist_t cP3t1085ConfigNormal[] = {
-    __END_WRITE_DATA__};
+/*! @brief Register settings for comparator mode, folded at compile time into one value per register. */
+const p3t1085_config_t cP3t1085ConfigNormal = P3T1085_CONFIG_INIT(
+    P3T1085UK_CR_4HZ, P3T1085UK_CONT_CONV_MODE, P3T1085UK_TS_COMP, P3T1085UK_POL_ACTIVE_LOW, P3T1085UK_HYST_1C,
+    75.0, 80.0);
 
 
 //-----------------------------------------------------------------------
@@ -74,6 +78,9 @@ enum EThermoStatMode eThermoStatBuffer;
 enum EPolarity ePolarity;
 enum ECRate eECRateBuffer;
 volatile bool gP3t1085IntFlag = false;
+p3t1085_window_t gWindow;
+/*! Sensor setup kept through a warm reset, not cleared by the startup code. */
+static p3t1085_snapshot_t gSnapshot __attribute__((section(".noinit")));
 
 gpio_pin_config_t int1_config = {
     kGPIO_DigitalInput,
@@ -84,7 +91,7 @@ gpio_pin_config_t int1_config = {
 // Functions
 //-----------------------------------------------------------------------
 
-void P3T1085_INT1_ISR(void)
+SENSOR_RAMFUNC void P3T1085_INT1_ISR(void)
 {
 /*     Clear external interrupt flag.
     GPIO_GpioClearInterruptFlags(P3T1085_INT1_GPIO, 1U << P3T1085_INT1_PIN);
@@ -92,7 +99,7 @@ void P3T1085_INT1_ISR(void)
     SDK_ISR_EXIT_BARRIER;*/
 
 	/* Clear external interrupt flag. */
-	GPIO_GpioClearInterruptFlags(ALERT_LED.base, 1U << ALERT_LED.pinNumber);
+	ALERT_ClearInterruptFlag();
 	gP3t1085IntFlag = true;
 	SDK_ISR_EXIT_BARRIER;
 }
@@ -114,6 +121,20 @@ void init_p3t1085_wakeup_int(void)
 	EnableIRQ(P3T1085_INT1_IRQ);
 }
 
+/*! -----------------------------------------------------------------------
+ *  @brief       Keep the sensor registers in the configuration snapshot
+ *  @details     Called after a menu option which may have changed a setting,
+ *               the next warm reset applies it again.
+ *  @return      void  There is no return value.
+ *  -----------------------------------------------------------------------*/
+static void saveSnapshot(void)
+{
+	if (SENSOR_ERROR_NONE != P3T1085_Snapshot_Capture(&gSnapshot, 0U, &p3t1085Driver))
+	{
+		PRINTF("\r\nSnapshot update failed\r\n");
+	}
+}
+
 /*! -----------------------------------------------------------------------
  *  @brief       Take input from User to enter Thigh value in celcius
  *  @details     This static function sets THigh Value as provided by user and print it back
@@ -146,6 +167,7 @@ static void fModifyThighValue(int get)
 		}
 		P3T1085_I2C_SetTHigh(&p3t1085Driver, fTemp);
 		P3T1085_I2C_GetTHigh(&p3t1085Driver, &fTemp);
+		P3T1085_Window_SetThresholds(&gWindow, gWindow.tLowQ4, (int16_t)(fTemp * 16));
 
 		PRINTF("Set T-High = %f°C\r\n", fTemp);
 	}
@@ -183,6 +205,7 @@ static void fModifyTlowValue(int get)
 		}
 		P3T1085_I2C_SetTLow(&p3t1085Driver, fTemp);
 		P3T1085_I2C_GetTLow(&p3t1085Driver, &fTemp);
+		P3T1085_Window_SetThresholds(&gWindow, (int16_t)(fTemp * 16), gWindow.tHighQ4);
 
 		PRINTF("Set TLow = %f°C\r\n", fTemp);
 	}
@@ -455,11 +478,11 @@ static void fModifyPolarity(int get)
 		{
 		case P3T1085UK_POL_ACTIVE_LOW:
 			PRINTF("\r\nALERT pin is active low\r\n");
-			GPIO_SetPinInterruptConfig(ALERT_LED.base, ALERT_LED.pinNumber, kGPIO_InterruptFallingEdge );
+			ALERT_SetInterruptConfig(kGPIO_InterruptFallingEdge);
 			break;
 		case P3T1085UK_POL_ACTIVE_HIGH:
 			PRINTF("\r\nALERT pin is active high\r\n");
-			GPIO_SetPinInterruptConfig(ALERT_LED.base, ALERT_LED.pinNumber, kGPIO_InterruptRisingEdge);
+			ALERT_SetInterruptConfig(kGPIO_InterruptRisingEdge);
 			break;
 		default:
 			PRINTF("\r\nError in getting Polarity value\r\n");
@@ -469,6 +492,32 @@ static void fModifyPolarity(int get)
 		PRINTF("Invalid Input, try next time\r\n");
 }
 
+/*! -----------------------------------------------------------------------
+ *  @brief       Centre T-Low and T-High on the current temperature
+ *  @details     This static function reads the temperature, which also clears the alert in
+ *               interrupt mode, and writes the auto-window around it. The snapshot keeps a
+ *               new window for a warm reset.
+ *  @return      void  There is no return value.
+ *  -----------------------------------------------------------------------*/
+static void fRecentreWindow()
+{
+	uint32_t writeCount = gWindow.writeCount;
+	int16_t tempQ4;
+
+	if ((SENSOR_ERROR_NONE != P3T1085_I2C_GetTempQ4(&p3t1085Driver, &tempQ4)) ||
+		(SENSOR_ERROR_NONE != P3T1085_Window_Recentre(&gWindow, tempQ4)))
+	{
+		PRINTF("\r\nAuto-window update failed\r\n");
+		return;
+	}
+	PRINTF("\r\nTemperature = %f°C, T-Low = %f°C, T-High = %f°C\r\n", (float)tempQ4 / 16,
+		(float)gWindow.tLowQ4 / 16, (float)gWindow.tHighQ4 / 16);
+	if (writeCount != gWindow.writeCount)
+	{
+		saveSnapshot();
+	}
+}
+
 /*! -----------------------------------------------------------------------
  *  @brief       Clear the Interrupt Alert Pin in P3T1085UK
  *  @details     This static function clear the alert signal in P3T1085UK
@@ -478,6 +527,12 @@ static void fModifyAlert()
 {
 	float fTemp, fTempHigh, fTempLow;
 
+	if (gWindow.enabled)
+	{
+		fRecentreWindow();
+		return;
+	}
+
 	P3T1085_I2C_GetTemp(&p3t1085Driver, &temperature);
 	P3T1085_I2C_GetTLow(&p3t1085Driver, &fTempLow);
 	P3T1085_I2C_GetTHigh(&p3t1085Driver, &fTempHigh);
@@ -529,9 +584,36 @@ static void fModifyAlert()
 	}
 }
 
+/*! -----------------------------------------------------------------------
+ *  @brief       Enable or disable the auto-window mode
+ *  @details     This static function takes the band from the user, 0 disables the mode.
+ *               The window is centred on the current temperature at once.
+ *  @return      void  There is no return value.
+ *  -----------------------------------------------------------------------*/
+static void fModifyAutoWindow()
+{
+	float fBand;
+
+	PRINTF("\r\nEnter the band in Celcius (0 to disable, up to 100°C)\r\n->");
+	SCANF("%f", &fBand);
+
+	if (fBand == 0)
+	{
+		P3T1085_Window_Enable(&gWindow, false, 0);
+		PRINTF("\r\nAuto-window disabled\r\n");
+		return;
+	}
+	if (SENSOR_ERROR_NONE != P3T1085_Window_Enable(&gWindow, true, (int16_t)(fBand * 16 + 0.5f)))
+	{
+		PRINTF("\r\nBand should be in range from 0.0625°C to 100°C\r\n");
+		return;
+	}
+	fRecentreWindow();
+}
+
 static void checkAlert()
 {
-	uint32_t flag = pGpioDriver->read_pin(&ALERT_LED);
+	uint32_t flag = ALERT_PinRead();
 	P3T1085_I2C_GetPolarity(&p3t1085Driver, &ePolarity);
 	if(ePolarity==P3T1085UK_POL_ACTIVE_LOW)
 	{
@@ -566,6 +648,7 @@ int main(void)
     int32_t status;
     uint32_t input;
     char dummy;
+    bool warmStart;
 
 #if RTE_I2C0_DMA_EN
 /*  Enable DMA clock. */
@@ -587,6 +670,9 @@ int main(void)
 
     PRINTF("\r\nISSDK P3T1085UK sensor driver example demonstration with comparator mode.\r\n");
 
+    /*! A valid snapshot left by the last reset gives the bus speed and the sensor setup. */
+    warmStart = P3T1085_Snapshot_IsValid(&gSnapshot) && (0U != gSnapshot.sensorCount);
+
     /*! Initialize the I2C driver. */
     status = I2Cdrv->Initialize(I2C_S_SIGNAL_EVENT);
     if (ARM_DRIVER_OK != status)
@@ -604,7 +690,7 @@ int main(void)
     }
 
     /*! Set the I2C bus speed. */
-    status = I2Cdrv->Control(ARM_I2C_BUS_SPEED, ARM_I2C_BUS_SPEED_FAST);
+    status = I2Cdrv->Control(ARM_I2C_BUS_SPEED, warmStart ? gSnapshot.busSpeed : SENSOR_BUS_SPEED);
     if (ARM_DRIVER_OK != status)
     {
         PRINTF("\r\n I2C Control Mode setting Failed\r\n");
@@ -619,8 +705,41 @@ int main(void)
         return -1;
     }
 
+    /*! Warm start: write the registers of the snapshot, without read before or after. */
+    if (warmStart)
+    {
+        warmStart = (SENSOR_ERROR_NONE == P3T1085_Snapshot_Apply(&gSnapshot, 0U, &p3t1085Driver));
+    }
+
+    /*! Cold start: apply and verify the complete sensor configuration, then keep it in the snapshot. */
+    if (warmStart)
+    {
+        PRINTF("\r\nWarm start, %u registers written\r\n", P3T1085_SNAPSHOT_REG_COUNT);
+    }
+    else
+    {
+        status = P3T1085_I2C_Configure(&p3t1085Driver, &cP3t1085ConfigNormal);
+        if (SENSOR_ERROR_NONE != status)
+        {
+            PRINTF("\r\n Sensor Configuration Failed\r\n");
+            return -1;
+        }
+        P3T1085_Snapshot_Init(&gSnapshot, SENSOR_BUS_SPEED);
+        P3T1085_Snapshot_Set(&gSnapshot, 0U, &p3t1085Driver, &cP3t1085ConfigNormal);
+    }
+
+    /*! Cache the thresholds of the snapshot for the auto-window mode, it starts disabled. */
+    P3T1085_Window_Init(&gWindow, &p3t1085Driver, &gSnapshot.sensors[0].config);
+
 	while (1)/* Forever loop */
 	{
+		/* In auto-window mode an ALERT only moves the window, no user input needed. */
+		if (gP3t1085IntFlag && gWindow.enabled)
+		{
+			gP3t1085IntFlag = false;
+			fRecentreWindow();
+		}
+
 		status = P3T1085_I2C_GetTemp(&p3t1085Driver, &temperature);
 		PRINTF("\r\nTemperature = %f°C\r\n", temperature);
 		PRINTF("\r\n");
@@ -649,7 +768,8 @@ int main(void)
 		PRINTF("15. Get Polarity\r\n");
 		PRINTF("16. Clear ALERT in Under-Tempearture and Over-Temperature Condition\r\n");
 		PRINTF("17. Check ALERT LED\r\n");
-		PRINTF("18. Exit\r\n");
+		PRINTF("18. Auto-window: re-centre T-Low/T-High after each ALERT\r\n");
+		PRINTF("19. Exit\r\n");
 		PRINTF("**************************\r\n");
 		SCANF("%d", &input);
 		switch (input)
@@ -707,10 +827,18 @@ int main(void)
 			checkAlert();
 			break;
 		case 18:
+			fModifyAutoWindow();
+			break;
+		case 19:
 			return 0;
 		default:
 			PRINTF("Invalid input, Continuing reading temperature\r\n");
 		}
+		/* The even options from 2 to 16 change settings. */
+		if ((input >= 2U) && (input <= 16U) && ((input % 2U) == 0U))
+		{
+			saveSnapshot();
+		}
 		PRINTF("\r\nPress Enter to goto Main Menu\r\n");
 		do
 		{
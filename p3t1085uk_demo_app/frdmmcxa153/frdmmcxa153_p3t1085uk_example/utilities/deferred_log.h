@@ -0,0 +1,121 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file deferred_log.h
+ * @brief Deferred logging utilities.
+
+    This file provides a logging facility which does not format text on the device.
+    Each DLOG() call stores the address of its format string (the format ID) and the
+    raw 32-bit arguments into a RAM ring. The ring is shipped unformatted by DLog_Flush()
+    and expanded on the host by tools/dlog_decode.py using the format strings of the ELF.
+*/
+
+#ifndef __DEFERRED_LOG_H__
+#define __DEFERRED_LOG_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief Definition to enable the deferred log, DLOG() compiles to nothing when disabled. */
+#ifndef DLOG_ENABLE
+#define DLOG_ENABLE 0U
+#endif /* DLOG_ENABLE */
+
+/*! @brief Size of the record ring in 32-bit words, must be a power of two. */
+#ifndef DLOG_BUFFER_WORDS
+#define DLOG_BUFFER_WORDS 256U
+#endif /* DLOG_BUFFER_WORDS */
+
+/*! @brief Maximum number of arguments of a single DLOG() call. */
+#define DLOG_MAX_ARGS 8U
+
+/*! @brief Record header layout: argument count in the top nibble, format ID below.
+ *         The format ID is the offset of the format string in the DLOG_FMT_SECTION section. */
+#define DLOG_ID_MASK     0x0FFFFFFFU
+#define DLOG_NARGS_SHIFT 28U
+
+/*! @brief Word emitted at the start of every flush, followed by the dropped record count. */
+#define DLOG_SYNC_WORD 0xFFFFFFFFU
+
+/*! @brief Format strings are grouped in their own section. Its name is a C identifier, so the
+ *         linker places it in flash after the read-only data and defines __start_dlog_fmt. */
+#define DLOG_FMT_SECTION __attribute__((section("dlog_fmt"), used))
+
+/*! @brief Count the variadic arguments of DLOG(), up to DLOG_MAX_ARGS. */
+#define DLOG_NARGS(...) DLOG_NARGS_(0, ##__VA_ARGS__, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define DLOG_NARGS_(_0, _1, _2, _3, _4, _5, _6, _7, _8, N, ...) N
+
+/*!
+ * @brief Record a log entry without formatting it.
+ *
+ * Arguments are captured as 32-bit integers, so only integer conversions
+ * (%d %i %u %x %X %o %c %p) and %T for 1/16 degree Celsius values are supported.
+ * Pass temperatures as fixed-point values rather than float.
+ */
+#if (defined(DLOG_ENABLE) && (DLOG_ENABLE > 0U))
+#define DLOG(fmt, ...)                                                     \
+    do                                                                     \
+    {                                                                      \
+        static const char s_dlogFmt[] DLOG_FMT_SECTION = fmt;              \
+        DLog_Write(s_dlogFmt, DLOG_NARGS(__VA_ARGS__), ##__VA_ARGS__);     \
+    } while (0)
+#else
+#define DLOG(fmt, ...) \
+    do                 \
+    {                  \
+    } while (0)
+#endif /* DLOG_ENABLE */
+
+/*! @brief Output function used by DLog_Flush() to ship the raw records. */
+typedef void (*dlog_output_t)(const uint8_t *pData, size_t size);
+
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*! @brief       Function to reset the deferred log.
+ *  @details     This function discards all pending records and clears the dropped record count.
+ *  @param[in]   void.
+ *  @return      void.
+ *  @constraints None.
+ *  @reeentrant  No
+ */
+void DLog_Init(void);
+
+/*! @brief       Function to record a log entry.
+ *  @details     This function stores the format ID and the raw arguments in the ring.
+ *               When the ring is full the record is dropped and counted.
+ *               Use the DLOG() macro rather than calling this function directly.
+ *  @param[in]   fmt   The format string, its offset in the format section is the format ID.
+ *  @param[in]   nargs The number of 32-bit arguments that follow.
+ *  @return      void.
+ *  @constraints nargs must not exceed DLOG_MAX_ARGS.
+ *  @reeentrant  Yes, it may be called from interrupt context.
+ */
+void DLog_Write(const char *fmt, uint32_t nargs, ...);
+
+/*! @brief       Function to ship the pending records.
+ *  @details     This function emits DLOG_SYNC_WORD, the dropped record count and then
+ *               all pending records as raw little-endian words through the output function.
+ *  @param[in]   output The function which transmits the raw bytes.
+ *  @return      uint32_t The number of record words shipped.
+ *  @constraints Only one context may flush at a time.
+ *  @reeentrant  No
+ */
+uint32_t DLog_Flush(dlog_output_t output);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif // __DEFERRED_LOG_H__
@@ -70,6 +70,20 @@ static int32_t ConvertFloatRadixNumToString(char *numstr, void *nump, int32_t ra
 
 #endif /* PRINTF_FLOAT_ENABLE */
 
+#if (defined(PRINTF_TEMP_Q4_ENABLE) && (PRINTF_TEMP_Q4_ENABLE > 0U))
+/*!
+ * @brief Converts a 1/16 degree Celsius fixed-point number to a string and return its length.
+ *
+ * @param[in] numstr            Converted string of the number, built in reverse order.
+ * @param[in] q4                The number in 1/16 degree Celsius units.
+ * @param[in] add_sign          Whether a '-' is emitted for negative numbers.
+ * @param[in] precision_width   Specify the precision width.
+
+ * @return Length of the converted string.
+ */
+static int32_t ConvertTempQ4ToString(char *numstr, int32_t q4, bool add_sign, uint32_t precision_width);
+#endif /* PRINTF_TEMP_Q4_ENABLE */
+
 /*************Code for process formatted data*******************************/
 #if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
 static uint8_t PrintGetSignChar(long long int ival, uint32_t flags_used, char *schar)
@@ -105,6 +119,10 @@ static uint32_t PrintGetWidth(const char **p, va_list *ap)
     uint8_t done         = 0U;
     char c;
 
+#if !(defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
+    /* Only a '*' width takes an argument. */
+    (void)ap;
+#endif /* PRINTF_ADVANCED_ENABLE */
     while (0U == done)
     {
         c = *(++(*p));
@@ -139,6 +157,9 @@ static uint32_t PrintGetPrecision(const char **s, va_list *ap, bool *valid_preci
     {
         *valid_precision_width = false;
     }
+#else
+    (void)ap;
+    (void)valid_precision_width;
 #endif /* PRINTF_ADVANCED_ENABLE */
     if (*++p == '.')
     {
@@ -244,6 +265,8 @@ static void PrintOutputdifFobpu(uint32_t flags_used,
         cb(buf, count, schar, 1);
     }
 #else
+    (void)flags_used;
+    (void)schar;
     cb(buf, count, ' ', (int)field_width - (int)vlen);
 #endif /* PRINTF_ADVANCED_ENABLE */
     while ('\0' != (*vstrp))
@@ -305,6 +328,8 @@ static void PrintOutputxX(uint32_t flags_used,
         vlen += 2U;
     }
 #else
+    (void)flags_used;
+    (void)use_caps;
     cb(buf, count, ' ', (int)field_width - (int)vlen);
 #endif /* PRINTF_ADVANCED_ENABLE */
     while ('\0' != (*vstrp))
@@ -752,6 +777,125 @@ static int32_t ConvertFloatRadixNumToString(char *numstr, void *nump, int32_t ra
 }
 #endif /* PRINTF_FLOAT_ENABLE */
 
+#if (defined(PRINTF_TEMP_Q4_ENABLE) && (PRINTF_TEMP_Q4_ENABLE > 0U))
+/*! @brief Maximum number of fractional digits printed for %T, bounded by the conversion buffer. */
+#define TEMP_Q4_MAX_PRECISION 24U
+/*! @brief Number of decimal digits needed to represent 1/16 exactly. */
+#define TEMP_Q4_EXACT_DIGITS 4U
+
+/* Decimal value of each 1/16 step, scaled by 10^TEMP_Q4_EXACT_DIGITS. */
+static const uint16_t s_tempQ4Fraction[16] = {0U,    625U,  1250U, 1875U, 2500U, 3125U, 3750U, 4375U,
+                                              5000U, 5625U, 6250U, 6875U, 7500U, 8125U, 8750U, 9375U};
+static const uint16_t s_tempQ4Pow10[TEMP_Q4_EXACT_DIGITS + 1U] = {1U, 10U, 100U, 1000U, 10000U};
+
+static int32_t ConvertTempQ4ToString(char *numstr, int32_t q4, bool add_sign, uint32_t precision_width)
+{
+    uint32_t magnitude;
+    uint32_t intpart;
+    uint32_t fracpart;
+    uint32_t fracdigits;
+    uint32_t divisor;
+    uint32_t remainder;
+    uint32_t lastdigit;
+    uint32_t i;
+    int32_t nlen;
+    char *nstrp;
+
+    nlen     = 0;
+    nstrp    = numstr;
+    *nstrp++ = '\0';
+
+    if (precision_width > TEMP_Q4_MAX_PRECISION)
+    {
+        precision_width = TEMP_Q4_MAX_PRECISION;
+    }
+
+    /* Negate in unsigned arithmetic, INT32_MIN has no positive int32_t. */
+    magnitude = (q4 < 0) ? (0U - (uint32_t)q4) : (uint32_t)q4;
+    intpart   = magnitude >> 4U;
+    fracpart  = s_tempQ4Fraction[magnitude & 0xFU];
+
+    /* Round half to even when fewer digits than the exact representation are requested. */
+    fracdigits = TEMP_Q4_EXACT_DIGITS;
+    if (precision_width < TEMP_Q4_EXACT_DIGITS)
+    {
+        divisor    = s_tempQ4Pow10[TEMP_Q4_EXACT_DIGITS - precision_width];
+        remainder  = fracpart % divisor;
+        fracpart   = fracpart / divisor;
+        fracdigits = precision_width;
+        lastdigit  = (0U != precision_width) ? fracpart : intpart;
+        if ((remainder > (divisor >> 1U)) || ((remainder == (divisor >> 1U)) && (0U != (lastdigit & 1U))))
+        {
+            fracpart++;
+        }
+        if (fracpart >= s_tempQ4Pow10[precision_width])
+        {
+            fracpart -= s_tempQ4Pow10[precision_width];
+            intpart++;
+        }
+    }
+
+    /* Process fractional part, trailing zeros beyond the exact digits first. */
+    for (i = fracdigits; i < precision_width; i++)
+    {
+        *nstrp++ = '0';
+        ++nlen;
+    }
+    for (i = 0U; i < fracdigits; i++)
+    {
+        *nstrp++ = (char)('0' + (fracpart % 10U));
+        fracpart /= 10U;
+        ++nlen;
+    }
+    if (0U != precision_width)
+    {
+        *nstrp++ = '.';
+        ++nlen;
+    }
+
+    /* Process integer part. */
+    do
+    {
+        *nstrp++ = (char)('0' + (intpart % 10U));
+        intpart /= 10U;
+        ++nlen;
+    } while (0U != intpart);
+
+    if (add_sign && (q4 < 0))
+    {
+        *nstrp++ = '-';
+        ++nlen;
+    }
+    return nlen;
+}
+
+/*!
+ * brief Converts a 1/16 degree Celsius fixed-point number to a decimal string.
+ *
+ * param[out] buf              Output buffer, at least 32 bytes.
+ * param[in]  q4               Temperature in 1/16 degree Celsius units.
+ * param[in]  precision_width  Number of fractional digits, 4 gives the exact value.
+ *
+ * return Length of the string written to buf, excluding the terminating null.
+ */
+int32_t StrFormatTempQ4(char *buf, int32_t q4, uint32_t precision_width)
+{
+    char vstr[33];
+    char *vstrp;
+    int32_t vlen;
+
+    vlen  = ConvertTempQ4ToString(vstr, q4, true, precision_width);
+    vstrp = &vstr[vlen];
+    while ('\0' != (*vstrp))
+    {
+        *buf++ = *vstrp--;
+    }
+    *buf = '\0';
+
+    return vlen;
+}
+#endif /* PRINTF_TEMP_Q4_ENABLE */
+
 /*!
  * brief This function outputs its parameters according to a formatted string.
  *
@@ -759,15 +903,16 @@ static int32_t ConvertFloatRadixNumToString(char *numstr, void *nump, int32_t ra
  * (*func_ptr)(c);
  *
  * param[in] fmt   Format string for printf.
- * param[in] ap    Arguments to printf.
+ * param[in] args  Arguments to printf.
  * param[in] buf  pointer to the buffer
  * param cb print callback function pointer
  *
  * return Number of characters to be print
  */
-int StrFormatPrintf(const char *fmt, va_list ap, char *buf, printfCb cb)
+int StrFormatPrintf(const char *fmt, va_list args, char *buf, printfCb cb)
 {
-    /* va_list ap; */
+    /* Own copy, its address is passed on: a va_list parameter may be an array adjusted to a pointer. */
+    va_list ap;
     const char *p;
     char c;
 
@@ -803,6 +948,7 @@ int StrFormatPrintf(const char *fmt, va_list ap, char *buf, printfCb cb)
     double fval;
 #endif /* PRINTF_FLOAT_ENABLE */
 
+    va_copy(ap, args);
     /* Start parsing apart the format string and display appropriate formats and data. */
     p = fmt;
     while (true)
@@ -900,6 +1046,22 @@ int StrFormatPrintf(const char *fmt, va_list ap, char *buf, printfCb cb)
                 (void)va_arg(ap, double);
 #endif /* PRINTF_FLOAT_ENABLE */
             }
+#if (defined(PRINTF_TEMP_Q4_ENABLE) && (PRINTF_TEMP_Q4_ENABLE > 0U))
+            else if (c == 'T')
+            {
+                ival = (STR_FORMAT_PRINTF_IVAL_TYPE)va_arg(ap, int);
+#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
+                vlen  = ConvertTempQ4ToString(vstr, (int32_t)ival, false, precision_width);
+                vstrp = &vstr[vlen];
+                vlen += (int32_t)PrintGetSignChar(ival, flags_used, &schar);
+                PrintOutputdifFobpu(flags_used, field_width, (unsigned int)vlen, schar, vstrp, cb, buf, &count);
+#else
+                vlen  = ConvertTempQ4ToString(vstr, (int32_t)ival, true, precision_width);
+                vstrp = &vstr[vlen];
+                PrintOutputdifFobpu(0U, field_width, (unsigned int)vlen, '\0', vstrp, cb, buf, &count);
+#endif /* PRINTF_ADVANCED_ENABLE */
+            }
+#endif /* PRINTF_TEMP_Q4_ENABLE */
             else if (1U == PrintIsxX(c))
             {
                 if (c == 'x')
@@ -941,8 +1103,10 @@ int StrFormatPrintf(const char *fmt, va_list ap, char *buf, printfCb cb)
                      * Orignal code: uval = (STR_FORMAT_PRINTF_UVAL_TYPE)(uint32_t)va_arg(ap, void *);
                      */
                     void *pval;
+                    uintptr_t pointer;
                     pval = (void *)va_arg(ap, void *);
-                    (void)memcpy((void *)&uval, (void *)&pval, sizeof(void *));
+                    (void)memcpy((void *)&pointer, (void *)&pval, sizeof(pointer));
+                    uval = (STR_FORMAT_PRINTF_UVAL_TYPE)pointer;
                 }
                 else
                 {
@@ -1040,6 +1204,7 @@ int StrFormatPrintf(const char *fmt, va_list ap, char *buf, printfCb cb)
         }
         p++;
     }
+    va_end(ap);
 
     return (int)count;
 }
@@ -1385,13 +1550,15 @@ static uint8_t StrFormatScanfStringHandling(char **str, uint32_t *flag, uint32_t
  *
  * param[in] line_ptr The input line of ASCII data.
  * param[in] format   Format first points to the format string.
- * param[in] args_ptr The list of parameters.
+ * param[in] args     The list of parameters.
  *
  * return Number of input items converted and assigned.
  * retval IO_EOF When line_ptr is empty string "".
  */
-int StrFormatScanf(const char *line_ptr, char *format, va_list args_ptr)
+int StrFormatScanf(const char *line_ptr, char *format, va_list args)
 {
+    /* Own copy, as in StrFormatPrintf(). */
+    va_list args_ptr;
     uint8_t base;
     int8_t neg;
     /* Identifier for the format string. */
@@ -1428,6 +1595,7 @@ int StrFormatScanf(const char *line_ptr, char *format, va_list args_ptr)
     {
         return -1;
     }
+    va_copy(args_ptr, args);
 
     /* Decode directives. */
     while (('\0' != (*c)) && ('\0' != (*p)))
@@ -1598,7 +1766,7 @@ int StrFormatScanf(const char *line_ptr, char *format, va_list args_ptr)
 
                 if ((fnum < HUGE_VAL) && (fnum > -HUGE_VAL))
                 {
-                    n_decode = (uint32_t)n_decode + (uint32_t)s - (uint32_t)p;
+                    n_decode += (uint32_t)((uintptr_t)s - (uintptr_t)p);
                     p        = s;
                     nassigned += StrFormatScanFillFloat(flag, &args_ptr, fnum);
                 }
@@ -1610,5 +1778,6 @@ int StrFormatScanf(const char *line_ptr, char *format, va_list args_ptr)
             }
         }
     }
+    va_end(args_ptr);
     return (int)nassigned;
 }
@@ -41,6 +41,11 @@
 #define SCANF_ADVANCED_ENABLE 0U
 #endif /* SCANF_ADVANCED_ENABLE */
 
+/*! @brief Definition to printf 1/16 degree Celsius fixed-point numbers with the %T specifier. */
+#ifndef PRINTF_TEMP_Q4_ENABLE
+#define PRINTF_TEMP_Q4_ENABLE 1U
+#endif /* PRINTF_TEMP_Q4_ENABLE */
+
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
@@ -99,13 +104,13 @@ typedef void (*printfCb)(char *buf, int32_t *indicator, char val, int len);
  * (*func_ptr)(c);
  *
  * @param[in] fmt   Format string for printf.
- * @param[in] ap  Arguments to printf.
+ * @param[in] args  Arguments to printf.
  * @param[in] buf  pointer to the buffer
  * @param cb print callbck function pointer
  *
  * @return Number of characters to be print
  */
-int StrFormatPrintf(const char *fmt, va_list ap, char *buf, printfCb cb);
+int StrFormatPrintf(const char *fmt, va_list args, char *buf, printfCb cb);
 
 /*!
  * @brief Converts an input line of ASCII characters based upon a provided
@@ -113,12 +118,29 @@ int StrFormatPrintf(const char *fmt, va_list ap, char *buf, printfCb cb);
  *
  * @param[in] line_ptr The input line of ASCII data.
  * @param[in] format   Format first points to the format string.
- * @param[in] args_ptr The list of parameters.
+ * @param[in] args     The list of parameters.
  *
  * @return Number of input items converted and assigned.
  * @retval IO_EOF When line_ptr is empty string "".
  */
-int StrFormatScanf(const char *line_ptr, char *format, va_list args_ptr);
+int StrFormatScanf(const char *line_ptr, char *format, va_list args);
+
+#if (defined(PRINTF_TEMP_Q4_ENABLE) && (PRINTF_TEMP_Q4_ENABLE > 0U))
+/*!
+ * @brief Converts a 1/16 degree Celsius fixed-point number to a decimal string.
+ *
+ * The fractional part is taken from a lookup table, so the output is exact and
+ * no floating point arithmetic is involved. This is the same conversion used by
+ * the %T format specifier of StrFormatPrintf.
+ *
+ * @param[out] buf              Output buffer, at least 32 bytes.
+ * @param[in]  q4               Temperature in 1/16 degree Celsius units.
+ * @param[in]  precision_width  Number of fractional digits, 4 gives the exact value.
+ *
+ * @return Length of the string written to buf, excluding the terminating null.
+ */
+int32_t StrFormatTempQ4(char *buf, int32_t q4, uint32_t precision_width);
+#endif /* PRINTF_TEMP_Q4_ENABLE */
 
 #if defined(__cplusplus)
 }
@@ -16,6 +16,11 @@
 
 // P3T1085 Sensor Information
 #define P3T1085_I2C_ADDR 0x48
+// Largest register block written to the sensor: one 16-bit register, the pointer does not auto-increment.
+#define P3T1085_MAX_WRITE_BYTES 2
+
+// Sizes the write buffers of the sensor interface for the sensors of this shield, its only definition.
+#define SENSOR_MAX_WRITE_BYTES P3T1085_MAX_WRITE_BYTES
 //#define P3T1085_INT1     D2
 #define P3T1085_INT2     A0
 
@@ -36,6 +36,14 @@ extern gpioHandleKSDK_t D2;
 //GPIO Handle
 extern gpioHandleKSDK_t ALERT_LED;
 
+// ALERT: Pin descriptor of the sensor ALERT output, ALERT_LED is initialized from it
+#define ALERT_GPIO        GPIO0
+#define ALERT_PIN         28U
+#define ALERT_IRQ         GPIO00_IRQn
+#define ALERT_CLOCK       kCLOCK_Gpio0
+#define ALERT_PORT_NUMBER PORTA_NUM
+GPIO_PIN_DEFINE_ACCESSORS(ALERT)
+
 // Internal Peripheral Pin Definitions
 extern gpioHandleKSDK_t RED_LED;
 extern gpioHandleKSDK_t GREEN_LED;
@@ -47,6 +55,9 @@ extern gpioHandleKSDK_t BLUE_LED;
 #define I2C_S1_DRIVER       Driver_I2C2
 #define I2C_S1_DEVICE_INDEX I2C2_INDEX
 #define I2C_S1_SIGNAL_EVENT I2C2_SignalEvent_t
+#define I2C_S1_BASE         LPI2C2
+#define I2C_S1_CLK_FREQ     LPI2C2_GetFreq()
+#define I2C_S1_INIT_PINS    LPI2C2_InitPins
 
 // SPI_S: Pin mapping and driver information default SPI brought to shield
 #define SPI_S_DRIVER       Driver_SPI1
@@ -82,4 +93,6 @@ status_t SMC_SetPowerModeWait(void *arg);
 status_t SMC_SetPowerModeVlpr(void *arg);
 /* @brief Wrapper API for handling all Clock related configurations. */
 void BOARD_BootClockRUN(void);
+/* @brief Functional clock of the I2C_S1 instance, attaches FRO 12M to its LP_FLEXCOMM. */
+uint32_t LPI2C2_GetFreq(void);
 #endif /* FRDM_MCXN947_H_ */
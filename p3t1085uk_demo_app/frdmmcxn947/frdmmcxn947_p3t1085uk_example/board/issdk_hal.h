@@ -31,5 +31,8 @@
 #define I2C_S_DRIVER       I2C_S1_DRIVER
 #define I2C_S_SIGNAL_EVENT I2C_S1_SIGNAL_EVENT
 #define I2C_S_DEVICE_INDEX I2C_S1_DEVICE_INDEX
+#define I2C_S_BASE         I2C_S1_BASE
+#define I2C_S_CLK_FREQ     I2C_S1_CLK_FREQ
+#define I2C_S_INIT_PINS    I2C_S1_INIT_PINS
 
 #endif // __ISSDK_HAL_H__
@@ -1109,7 +1109,9 @@ void LPI2C_MasterTransferCreateHandle(LPI2C_Type *base,
  * @retval #kStatus_LPI2C_Nak
  * @retval #kStatus_LPI2C_FifoError
  */
-static status_t LPI2C_RunTransferStateMachine(LPI2C_Type *base, lpi2c_master_handle_t *handle, bool *isDone)
+LPI2C_RAMFUNC static status_t LPI2C_RunTransferStateMachine(LPI2C_Type *base,
+                                                            lpi2c_master_handle_t *handle,
+                                                            bool *isDone)
 {
     uint32_t status;
     status_t result = kStatus_Success;
@@ -1569,7 +1571,7 @@ void LPI2C_MasterTransferAbort(LPI2C_Type *base, lpi2c_master_handle_t *handle)
  * param instance The LPI2C instance.
  * param lpi2cMasterHandle Pointer to the LPI2C master driver handle.
  */
-void LPI2C_MasterTransferHandleIRQ(uint32_t instance, void *lpi2cMasterHandle)
+LPI2C_RAMFUNC void LPI2C_MasterTransferHandleIRQ(uint32_t instance, void *lpi2cMasterHandle)
 {
     assert(lpi2cMasterHandle != NULL);
     assert(instance < ARRAY_SIZE(kLpi2cBases));
@@ -15,6 +15,13 @@
  * Definitions
  ******************************************************************************/
 
+/*! @brief Places the master interrupt path in code RAM (RAM2), as SENSOR_RAMFUNC does for the sensor layer. */
+#if defined(__MCUXPRESSO) && !defined(SENSOR_RAMFUNC_DISABLE)
+#define LPI2C_RAMFUNC __attribute__((section(".ramfunc.$RAM2"), noinline))
+#else
+#define LPI2C_RAMFUNC
+#endif
+
 /*!
  * @addtogroup lpi2c
  * @{
@@ -65,6 +65,8 @@ typedef struct _cmsis_lpi2c_interrupt_driver_state
     size_t slave_dataSize;          /*!< slave Transfer size */
     ARM_I2C_SignalEvent_t cb_event; /*!< call back function */
     uint8_t flags;                  /*!< Control and state flags. */
+    uint32_t subaddress;            /*!< Subaddress of the next master transmit */
+    uint8_t subaddressSize;         /*!< Subaddress size in bytes, 0 for none */
 } cmsis_lpi2c_interrupt_driver_state_t;
 
 #if (defined(FSL_FEATURE_SOC_EDMA_COUNT) && FSL_FEATURE_SOC_EDMA_COUNT)
@@ -91,6 +93,8 @@ typedef struct _cmsis_lpi2c_edma_driver_state
     edma_handle_t *edmaTxHandle;                    /*!< EDMA lpi2c Tx handle.       */
     edma_handle_t *edmaRxHandle;                    /*!< EDMA lpi2c Rx handle.       */
     uint8_t flags;                                  /*!< Control and state flags. */
+    uint32_t subaddress;                            /*!< Subaddress of the next master transmit */
+    uint8_t subaddressSize;                         /*!< Subaddress size in bytes, 0 for none */
 } cmsis_lpi2c_edma_driver_state_t;
 #endif /* FSL_FEATURE_SOC_EDMA_COUNT */
 
@@ -195,11 +199,14 @@ static int32_t LPI2C_Master_EdmaTransmit(
     int32_t ret;
     lpi2c_master_transfer_t masterXfer;
 
+    /* A subaddress set with ARM_I2C_SUBADDRESS only applies to this transfer */
+    masterXfer.subaddress     = lpi2c->subaddress;
+    masterXfer.subaddressSize = lpi2c->subaddressSize;
+    lpi2c->subaddressSize     = 0U;
+
     /* Setup the master transfer */
     masterXfer.slaveAddress   = (uint16_t)addr;
     masterXfer.direction      = kLPI2C_Write;
-    masterXfer.subaddress     = 0U;
-    masterXfer.subaddressSize = 0U;
     masterXfer.data           = (uint8_t *)data;
     masterXfer.dataSize       = num;
     masterXfer.flags          = (uint32_t)kLPI2C_TransferDefaultFlag;
@@ -325,6 +332,17 @@ static int32_t LPI2C_Master_EdmaControl(uint32_t control, uint32_t arg, cmsis_lp
             result = ARM_DRIVER_ERROR_UNSUPPORTED;
             break;
 
+        /* Subaddress sent from the command FIFO ahead of the data of the next master transmit */
+        case ARM_I2C_SUBADDRESS:
+            lpi2c->subaddress     = arg & ARM_I2C_SUBADDRESS_MASK;
+            lpi2c->subaddressSize = (uint8_t)(arg >> ARM_I2C_SUBADDRESS_SIZE_SHIFT);
+            result                = (lpi2c->subaddressSize <= 3U) ? ARM_DRIVER_OK : ARM_DRIVER_ERROR_PARAMETER;
+            if (ARM_DRIVER_OK != result)
+            {
+                lpi2c->subaddressSize = 0U;
+            }
+            break;
+
         /* Only support aborting data transfer when master transmit in master mode */
         case ARM_I2C_ABORT_TRANSFER:
 
@@ -477,7 +495,7 @@ static void KSDK_LPI2C_SLAVE_InterruptCallback(LPI2C_Type *base,
     }
 }
 
-static void KSDK_LPI2C_MASTER_InterruptCallback(LPI2C_Type *base,
+LPI2C_RAMFUNC static void KSDK_LPI2C_MASTER_InterruptCallback(LPI2C_Type *base,
                                                 lpi2c_master_handle_t *handle,
                                                 status_t status,
                                                 void *userData)
@@ -532,6 +550,11 @@ static int32_t LPI2C_Master_InterruptTransmit(
     int32_t ret;
     lpi2c_master_transfer_t masterXfer;
 
+    /* A subaddress set with ARM_I2C_SUBADDRESS only applies to this transfer */
+    masterXfer.subaddress     = lpi2c->subaddress;
+    masterXfer.subaddressSize = lpi2c->subaddressSize;
+    lpi2c->subaddressSize     = 0U;
+
     if (lpi2c->handle->master_handle.state != 0U)
     {
         return ARM_DRIVER_ERROR_BUSY; /* Master is busy */
@@ -544,8 +567,6 @@ static int32_t LPI2C_Master_InterruptTransmit(
     /* Setup the master transfer */
     masterXfer.slaveAddress   = (uint16_t)addr;
     masterXfer.direction      = kLPI2C_Write;
-    masterXfer.subaddress     = 0U;
-    masterXfer.subaddressSize = 0U;
     masterXfer.data           = (uint8_t *)data;
     masterXfer.dataSize       = num;
     masterXfer.flags          = (uint32_t)kLPI2C_TransferDefaultFlag;
@@ -764,6 +785,17 @@ static int32_t LPI2C_InterruptControl(uint32_t control, uint32_t arg, cmsis_lpi2
             result = ARM_DRIVER_ERROR_UNSUPPORTED;
             break;
 
+        /* Subaddress sent from the command FIFO ahead of the data of the next master transmit */
+        case ARM_I2C_SUBADDRESS:
+            lpi2c->subaddress     = arg & ARM_I2C_SUBADDRESS_MASK;
+            lpi2c->subaddressSize = (uint8_t)(arg >> ARM_I2C_SUBADDRESS_SIZE_SHIFT);
+            result                = (lpi2c->subaddressSize <= 3U) ? ARM_DRIVER_OK : ARM_DRIVER_ERROR_PARAMETER;
+            if (ARM_DRIVER_OK != result)
+            {
+                lpi2c->subaddressSize = 0U;
+            }
+            break;
+
         /* Only support aborting data transfer when master transmit(in master mode) or slave receive(in slave mode) */
         case ARM_I2C_ABORT_TRANSFER:
             /* Abort data transfer when slave receive(in slave mode) */
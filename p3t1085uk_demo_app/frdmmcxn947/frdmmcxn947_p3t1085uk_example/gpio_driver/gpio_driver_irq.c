@@ -12,12 +12,11 @@
 #include "fsl_gpio.h"
 #include "gpio_driver.h"
 
-extern void ksdk_gpio_handle_interrupt(GPIO_Type *base, port_number_t portNumber);
-
 /*******************************************************************************
  * Functions - GPIOIRQ implementation
  ******************************************************************/
-void PORT0_IRQHandler(void)
+GPIO_RAMFUNC void GPIO00_IRQHandler(void)
 {
-    ksdk_gpio_handle_interrupt(GPIO0, 0);
+    ksdk_gpio_handle_interrupt(GPIO0, PORTA_NUM);
+    SDK_ISR_EXIT_BARRIER;
 }
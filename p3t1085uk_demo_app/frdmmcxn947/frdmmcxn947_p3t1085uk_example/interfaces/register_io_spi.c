@@ -18,6 +18,7 @@
 #include "issdk_hal.h"
 #include "gpio_driver.h"
 #include "register_io_spi.h"
+#include "sensor_no_heap.h"
 
 /*******************************************************************************
  * Types
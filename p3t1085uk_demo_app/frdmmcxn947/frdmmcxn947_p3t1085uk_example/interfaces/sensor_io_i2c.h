@@ -69,4 +69,43 @@ int32_t Sensor_I2C_Read(ARM_DRIVER_I2C *pCommDrv,
                         const registerreadlist_t *pReadList,
                         uint8_t *pOutBuffer);
 
+/*! @brief       Write 16-bit register data to a sensor
+
+ *  @param[in]   pCommDrv        pointer to the I2C ARM driver to use
+ *  @param[in]   devInfo         The I2C device number and idle function.
+ *  @param[in]   slaveAddress    the I2C slave address to write to
+ *  @param[in]   pRegWriteList   a list of one or more 16-bit register/value pairs to write
+ *  @param[in]   bytesPerAddress number of register bytes per address step of the auto-incrementing
+ *                               register pointer (1 or 2), 0 if the device does not auto-increment.
+ *                               Consecutive entries at contiguous addresses are then written, and read
+ *                               for masked entries, as a single block transfer.
+ *
+ *  @return      returns the execution status of the operation using ::ESensorErrors
+ */
+int32_t Sensor_I2C_Write16(ARM_DRIVER_I2C *pCommDrv,
+                           registerDeviceInfo_t *devInfo,
+                           uint16_t slaveAddress,
+                           const registerwritelist16_t *pRegWriteList,
+                           uint8_t bytesPerAddress);
+
+/*! @brief       Read register data from a sensor, merging contiguous list entries
+
+ *  @param[in]   pCommDrv        pointer to the I2C ARM driver to use
+ *  @param[in]   devInfo         The I2C device number and idle function.
+ *  @param[in]   slaveAddress    the I2C slave address to read from
+ *  @param[in]   pReadList       a list of one or more register addresses and lengths to read
+ *  @param[in]   bytesPerAddress number of register bytes per address step of the auto-incrementing
+ *                               register pointer, 0 if the device does not auto-increment.
+ *                               An entry starting where the previous one ends is read in the same transfer.
+ *  @param[in]   pOutBuffer      a pointer of sufficient size to contain the requested read data
+ *
+ *  @return      returns the execution status of the operation using ::ESensorErrors
+ */
+int32_t Sensor_I2C_ReadCoalesced(ARM_DRIVER_I2C *pCommDrv,
+                                 registerDeviceInfo_t *devInfo,
+                                 uint16_t slaveAddress,
+                                 const registerreadlist_t *pReadList,
+                                 uint8_t bytesPerAddress,
+                                 uint8_t *pOutBuffer);
+
 #endif /* __SENSOR_IO_I2C_H */
@@ -16,6 +16,7 @@
 #include "sensor_drv.h"
 #include "systick_utils.h"
 #include "sensor_io_spi.h"
+#include "sensor_no_heap.h"
 
 /*******************************************************************************
  * Functions
@@ -0,0 +1,25 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file sensor_no_heap.h
+ * @brief The sensor_no_heap.h file makes a heap allocation a build error in the source including it.
+
+    Included last by the sources of the sensor stack. With SENSOR_NO_HEAP defined, a use of
+    malloc, calloc, realloc or free after it is a compile error, tools/mem_report.py --no-heap
+    then checks that none is linked in the image. A header included after it could not use
+    those names even in a macro, so no header includes it.
+*/
+
+#ifndef _SENSOR_NO_HEAP_H
+#define _SENSOR_NO_HEAP_H
+
+#if defined(SENSOR_NO_HEAP) && defined(__GNUC__)
+#include <stdlib.h>
+#pragma GCC poison malloc calloc realloc free
+#endif
+
+#endif /* _SENSOR_NO_HEAP_H */
@@ -0,0 +1,134 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file p3t1085uk_alarm.h
+ * @brief The p3t1085uk_alarm.h file describes the P3T1085UK comparator-mode alarm engine.
+
+    In comparator mode the ALERT output is active while the temperature is at or above THIGH,
+    or at or below TLOW, and is released once it has moved back by the hysteresis. The engine
+    tracks NORMAL, OVER and UNDER from the debounced ALERT level, the cached thresholds and the
+    last known temperature, so a state change costs no bus access.
+*/
+
+#ifndef P3T1085UK_ALARM_H_
+#define P3T1085UK_ALARM_H_
+
+/* Standard C Includes */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* ISSDK Includes */
+#include "p3t1085uk_drv.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief Temperature in 1/16 celsius units of a TLOW/THIGH register value. */
+#define P3T1085UK_TEMP_REG_TO_Q4(reg) ((int16_t)((int16_t)(reg) >> P3T1085UK_TEMP_CALC_SHIFT))
+
+enum EAlarmState
+{
+    P3T1085UK_ALARM_NORMAL = 0, /*!< ALERT inactive. */
+    P3T1085UK_ALARM_OVER = 1,   /*!< ALERT active, THIGH reached. */
+    P3T1085UK_ALARM_UNDER = 2,  /*!< ALERT active, TLOW reached. */
+};
+
+/*! @brief       Notification of an alarm state change.
+ *  @param[in]   pUserData The pointer given to P3T1085_Alarm_Init().
+ *  @param[in]   from      The previous state.
+ *  @param[in]   to        The new state.
+ */
+typedef void (*p3t1085_alarm_callback_t)(void *pUserData, enum EAlarmState from, enum EAlarmState to);
+
+/*!
+ * @brief This defines the alarm engine state, all temperatures are in 1/16 celsius units.
+ */
+typedef struct
+{
+    int16_t tLowQ4;                  /*!< Cached TLOW. */
+    int16_t tHighQ4;                 /*!< Cached THIGH. */
+    int16_t hystQ4;                  /*!< Cached hysteresis. */
+    int16_t tempQ4;                  /*!< Last known temperature. */
+    bool activeHigh;                 /*!< ALERT polarity. */
+    uint32_t glitchTicks;            /*!< Time the ALERT level must be stable before it is accepted. */
+    enum EAlarmState state;          /*!< Debounced state. */
+    volatile bool edgePending;       /*!< An ALERT edge waits for its glitch window. */
+    volatile bool edgeLevel;         /*!< Pin level after the last edge. */
+    volatile uint32_t edgeTicks;     /*!< Time of the last edge. */
+    p3t1085_alarm_callback_t callback;
+    void *pUserData;
+} p3t1085_alarm_t;
+
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+/*! @brief       The interface function to initialize the alarm engine.
+ *  @details     This function caches the thresholds, hysteresis and polarity of the configuration
+ *               applied with P3T1085_I2C_Configure(). The engine starts in NORMAL, feed the current
+ *               ALERT level with P3T1085_Alarm_OnEdge() to pick up an alarm already active.
+ *  @param[in]   pAlarm       the alarm engine.
+ *  @param[in]   pConfig      the sensor configuration, its thermostat mode must be comparator.
+ *  @param[in]   tempQ4       the last known temperature.
+ *  @param[in]   glitchTicks  the glitch window in the time unit used for the edges.
+ *  @param[in]   callback     the function notified of state changes, may be NULL.
+ *  @param[in]   pUserData    pointer passed to the callback.
+ *  @constraints None
+ *  @reeentrant  No
+ *  @return      ::P3T1085_Alarm_Init() returns the status .
+ */
+int32_t P3T1085_Alarm_Init(p3t1085_alarm_t *pAlarm,
+                           const p3t1085_config_t *pConfig,
+                           int16_t tempQ4,
+                           uint32_t glitchTicks,
+                           p3t1085_alarm_callback_t callback,
+                           void *pUserData);
+
+/*! @brief       The interface function to record an ALERT edge.
+ *  @details     This function restarts the glitch window with the new pin level.
+ *  @param[in]   pAlarm   the alarm engine.
+ *  @param[in]   level    the ALERT pin level after the edge.
+ *  @param[in]   ticks    the time of the edge.
+ *  @constraints None
+ *  @reeentrant  Yes, it may be called from interrupt context.
+ *  @return      void.
+ */
+void P3T1085_Alarm_OnEdge(p3t1085_alarm_t *pAlarm, bool level, uint32_t ticks);
+
+/*! @brief       The interface function to run the alarm engine.
+ *  @details     This function accepts the last edge once its glitch window has expired and the pin
+ *               still has the same level, then notifies the state change. A pulse shorter than the
+ *               window is dropped.
+ *  @param[in]   pAlarm   the alarm engine.
+ *  @param[in]   level    the current ALERT pin level.
+ *  @param[in]   ticks    the current time.
+ *  @constraints None
+ *  @reeentrant  No
+ *  @return      ::P3T1085_Alarm_Process() returns the current state.
+ */
+enum EAlarmState P3T1085_Alarm_Process(p3t1085_alarm_t *pAlarm, bool level, uint32_t ticks);
+
+/*! @brief       The interface function to give the engine a temperature read for another purpose.
+ *  @details     This function refines which threshold an active alarm belongs to.
+ *  @param[in]   pAlarm   the alarm engine.
+ *  @param[in]   tempQ4   the temperature.
+ *  @constraints None
+ *  @reeentrant  No
+ *  @return      void.
+ */
+void P3T1085_Alarm_UpdateTemp(p3t1085_alarm_t *pAlarm, int16_t tempQ4);
+
+/*! @brief       The interface functions to keep the cached settings in line with the sensor.
+ *  @details     Call them whenever the corresponding register is changed.
+ *  @constraints None
+ *  @reeentrant  No
+ *  @return      void.
+ */
+void P3T1085_Alarm_SetThresholds(p3t1085_alarm_t *pAlarm, int16_t tLowQ4, int16_t tHighQ4);
+void P3T1085_Alarm_SetHysteresis(p3t1085_alarm_t *pAlarm, enum EHysteresis eHyst);
+void P3T1085_Alarm_SetPolarity(p3t1085_alarm_t *pAlarm, enum EPolarity ePol);
+
+#endif /* P3T1085UK_ALARM_H_ */
@@ -0,0 +1,95 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file p3t1085uk_alert.h
+ * @brief The p3t1085uk_alert.h file describes the P3T1085UK ALERT router interface.
+
+    Each ALERT pin is registered through the gpio_driver pin_init() with a handler which starts
+    an asynchronous read of the Temp register of its sensor, on the bus of that sensor, directly
+    from the GPIO interrupt. The reading is delivered through a callback from the I2C interrupt
+    together with the number of CPU cycles elapsed since the edge was dispatched.
+    A route can also feed an alarm engine, which follows the ALERT level without any bus access.
+*/
+
+#ifndef P3T1085UK_ALERT_H_
+#define P3T1085UK_ALERT_H_
+
+/* Standard C Includes */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* ISSDK Includes */
+#include "p3t1085uk_drv.h"
+#include "p3t1085uk_alarm.h"
+#include "Driver_GPIO.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief Maximum number of ALERT pins which can be routed. */
+#ifndef P3T1085_ALERT_MAX_ROUTES
+#define P3T1085_ALERT_MAX_ROUTES 4
+#endif
+
+/*! @brief       Delivery of the temperature read on an ALERT edge.
+ *  @details     Called from the I2C interrupt, or from the GPIO interrupt if the read could not be started.
+ *  @param[in]   pUserData     The pointer given to P3T1085_Alert_AddRoute().
+ *  @param[in]   status        SENSOR_ERROR_NONE if tempQ4 is valid.
+ *  @param[in]   tempQ4        The temperature in 1/16 celsius units.
+ *  @param[in]   latencyCycles CPU cycles from the edge dispatch to the end of the read.
+ */
+typedef void (*p3t1085_alert_callback_t)(void *pUserData, int32_t status, int16_t tempQ4, uint32_t latencyCycles);
+
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+/*! @brief       The interface function to route an ALERT pin to a sensor.
+ *  @details     This function installs the ALERT pin through the gpio driver and binds it to the sensor
+ *               and the callback. It also starts the CPU cycle counter used for the latency.
+ *  @param[in]   pGpioDriver  the gpio driver owning the pin.
+ *  @param[in]   alertPin     the pin connected to the ALERT output of the sensor, the board ALERT pin
+ *                            (&ALERT_LED) is then read through its board accessor.
+ *  @param[in]   pPinConfig   the pin configuration for pin_init, NULL for the driver default.
+ *  @param[in]   pSensorHandle handle to the initialized sensor.
+ *  @param[in]   callback     the function receiving the readings, NULL to not read on edges.
+ *  @param[in]   pUserData    pointer passed to the callback.
+ *  @constraints Call before the sensor can assert ALERT.
+ *  @reeentrant  No
+ *  @return      ::P3T1085_Alert_AddRoute() returns the status .
+ */
+int32_t P3T1085_Alert_AddRoute(GENERIC_DRIVER_GPIO *pGpioDriver,
+                               pinID_t alertPin,
+                               void *pPinConfig,
+                               p3t1085_i2c_sensorhandle_t *pSensorHandle,
+                               p3t1085_alert_callback_t callback,
+                               void *pUserData);
+
+/*! @brief       The interface function to feed the ALERT edges of a sensor to an alarm engine.
+ *  @details     This function binds the initialized alarm engine to the route of the sensor and
+ *               passes it the current ALERT level. The glitch window is counted in CPU cycles.
+ *               The alarm returns to normal on the release edge, so configure the pin to
+ *               interrupt on both edges. The release edge does not start a read.
+ *  @param[in]   pSensorHandle handle to the sensor of an existing route.
+ *  @param[in]   pAlarm       the alarm engine.
+ *  @constraints None
+ *  @reeentrant  No
+ *  @return      ::P3T1085_Alert_AttachAlarm() returns the status .
+ */
+int32_t P3T1085_Alert_AttachAlarm(p3t1085_i2c_sensorhandle_t *pSensorHandle, p3t1085_alarm_t *pAlarm);
+
+/*! @brief       The interface function to run the deferred work of the routes.
+ *  @details     An edge which finds its bus busy with a blocking transfer is deferred,
+ *               this function starts its read. Edges deferred by another asynchronous read
+ *               are restarted from the I2C interrupt. It also runs the attached alarm engines,
+ *               which notify their state changes from here. Call it from the main loop.
+ *  @constraints None
+ *  @reeentrant  No
+ *  @return      void.
+ */
+void P3T1085_Alert_Poll(void);
+
+#endif /* P3T1085UK_ALERT_H_ */
@@ -0,0 +1,82 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file p3t1085uk_convert.c
+ * @brief The p3t1085uk_convert.c file implements the batch conversion of P3T1085UK temperatures.
+ */
+
+//-----------------------------------------------------------------------
+// ISSDK Includes
+//-----------------------------------------------------------------------
+#include "fsl_common.h"
+#include "p3t1085uk.h"
+#include "p3t1085uk_convert.h"
+#include "sensor_no_heap.h"
+
+//-----------------------------------------------------------------------
+// Macros
+//-----------------------------------------------------------------------
+/* 1000/16 = 125/2: multiply by 125 and halve. */
+#define P3T1085_MILLIC_PER_Q4_X2 (125)
+
+//-----------------------------------------------------------------------
+// Functions
+//-----------------------------------------------------------------------
+void P3T1085_Convert_RawToQ4(const uint8_t *pRaw, int16_t *pTempQ4, uint32_t count)
+{
+    uint32_t i = 0U;
+
+#if (P3T1085_CONVERT_SIMD > 0U)
+    /* REV16 turns two big-endian pairs into two halfwords, the arithmetic shifts drop the
+     * unused bits of each with its sign and PKHBT packs both results into one store. */
+    for (; (i + 2U) <= count; i += 2U)
+    {
+        uint32_t raw = __REV16(__UNALIGNED_UINT32_READ(&pRaw[2U * i]));
+        int32_t low  = (int32_t)(int16_t)raw >> P3T1085UK_TEMP_IGNORE_SHIFT;
+        int32_t high = (int32_t)raw >> (16U + P3T1085UK_TEMP_IGNORE_SHIFT);
+
+        __UNALIGNED_UINT32_WRITE(&pTempQ4[i], __PKHBT(low, high, 16));
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        uint16_t raw = (uint16_t)((uint16_t)pRaw[2U * i] << 8) | (uint16_t)pRaw[2U * i + 1U];
+
+        pTempQ4[i] = (int16_t)((int16_t)raw >> P3T1085UK_TEMP_IGNORE_SHIFT);
+    }
+}
+
+void P3T1085_Convert_Q4ToFloat(const int16_t *pTempQ4, float *pTemp, uint32_t count)
+{
+    /* The FPU has no SIMD, a single precision multiply keeps each reading to a convert and a multiply. */
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        pTemp[i] = (float)pTempQ4[i] * (float)P3T1085UK_CELCIUS_CONV_VAL;
+    }
+}
+
+void P3T1085_Convert_Q4ToMilliC(const int16_t *pTempQ4, int32_t *pMilliC, uint32_t count)
+{
+    uint32_t i = 0U;
+
+#if (P3T1085_CONVERT_SIMD > 0U)
+    /* One load feeds two 16x16 multiplies: SMUAD takes the bottom reading, SMUADX the top one. */
+    for (; (i + 2U) <= count; i += 2U)
+    {
+        uint32_t q4 = __UNALIGNED_UINT32_READ(&pTempQ4[i]);
+
+        pMilliC[i]      = (int32_t)__SMUAD(q4, P3T1085_MILLIC_PER_Q4_X2) >> 1;
+        pMilliC[i + 1U] = (int32_t)__SMUADX(q4, P3T1085_MILLIC_PER_Q4_X2) >> 1;
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        pMilliC[i] = ((int32_t)pTempQ4[i] * P3T1085_MILLIC_PER_Q4_X2) >> 1;
+    }
+}
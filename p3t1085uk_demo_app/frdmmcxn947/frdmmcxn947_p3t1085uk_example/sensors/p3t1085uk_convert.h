@@ -0,0 +1,70 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file p3t1085uk_convert.h
+ * @brief The p3t1085uk_convert.h file describes the batch conversion of P3T1085UK temperatures.
+
+    These functions convert buffers of readings at once, for example a ring or a DMA buffer
+    drained after many conversions, instead of one register value at a time. On cores with the
+    DSP extension two readings are converted per 32-bit word with the SIMD instructions, the
+    portable C loop handles the other cores, host builds and the odd last reading.
+*/
+
+#ifndef P3T1085UK_CONVERT_H_
+#define P3T1085UK_CONVERT_H_
+
+/* Standard C Includes */
+#include <stdint.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief Definition to use the DSP SIMD instructions, set to 0 to benchmark the portable C loop. */
+#ifndef P3T1085_CONVERT_SIMD
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#define P3T1085_CONVERT_SIMD 1U
+#else
+#define P3T1085_CONVERT_SIMD 0U
+#endif
+#endif /* P3T1085_CONVERT_SIMD */
+
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+/*! @brief       The interface function to convert raw Temp register values.
+ *  @details     This function converts register byte pairs, MSB first as read from the bus,
+ *               into 1/16 celsius units like P3T1085_I2C_TempRawToQ4().
+ *  @param[in]   pRaw     the register bytes, 2 per reading, no alignment needed.
+ *  @param[out]  pTempQ4  the temperatures, no alignment needed beyond int16_t.
+ *  @param[in]   count    the number of readings.
+ *  @constraints pRaw and pTempQ4 may be the same buffer.
+ *  @reeentrant  Yes
+ *  @return      void.
+ */
+void P3T1085_Convert_RawToQ4(const uint8_t *pRaw, int16_t *pTempQ4, uint32_t count);
+
+/*! @brief       The interface function to convert temperatures to celsius.
+ *  @param[in]   pTempQ4  the temperatures in 1/16 celsius units.
+ *  @param[out]  pTemp    the temperatures in celsius, exact since every step is a power of two.
+ *  @param[in]   count    the number of readings.
+ *  @constraints None
+ *  @reeentrant  Yes
+ *  @return      void.
+ */
+void P3T1085_Convert_Q4ToFloat(const int16_t *pTempQ4, float *pTemp, uint32_t count);
+
+/*! @brief       The interface function to convert temperatures to milli celsius.
+ *  @param[in]   pTempQ4  the temperatures in 1/16 celsius units.
+ *  @param[out]  pMilliC  the temperatures in 1/1000 celsius, rounded down to an integer.
+ *  @param[in]   count    the number of readings.
+ *  @constraints None
+ *  @reeentrant  Yes
+ *  @return      void.
+ */
+void P3T1085_Convert_Q4ToMilliC(const int16_t *pTempQ4, int32_t *pMilliC, uint32_t count);
+
+#endif /* P3T1085UK_CONVERT_H_ */
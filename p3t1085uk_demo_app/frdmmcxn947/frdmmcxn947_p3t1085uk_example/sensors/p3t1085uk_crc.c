@@ -0,0 +1,35 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file p3t1085uk_crc.c
+ * @brief The p3t1085uk_crc.c file implements the CRC-32 of the P3T1085UK images and records.
+ */
+
+//-----------------------------------------------------------------------
+// ISSDK Includes
+//-----------------------------------------------------------------------
+#include "p3t1085uk_crc.h"
+#include "sensor_no_heap.h"
+
+//-----------------------------------------------------------------------
+// Functions
+//-----------------------------------------------------------------------
+uint32_t P3T1085_Crc32(uint32_t crc, const uint8_t *pData, uint32_t size)
+{
+    static const uint32_t cTable[16] = {0x00000000U, 0x1DB71064U, 0x3B6E20C8U, 0x26D930ACU, 0x76DC4190U, 0x6B6B51F4U,
+                                        0x4DB26158U, 0x5005713CU, 0xEDB88320U, 0xF00F9344U, 0xD6D6A3E8U, 0xCB61B38CU,
+                                        0x9B64C2B0U, 0x86D3D2D4U, 0xA00AE278U, 0xBDBDF21CU};
+
+    crc = ~crc;
+    for (uint32_t i = 0; i < size; i++)
+    {
+        crc = (crc >> 4) ^ cTable[(crc ^ pData[i]) & 0x0FU];
+        crc = (crc >> 4) ^ cTable[(crc ^ ((uint32_t)pData[i] >> 4)) & 0x0FU];
+    }
+
+    return ~crc;
+}
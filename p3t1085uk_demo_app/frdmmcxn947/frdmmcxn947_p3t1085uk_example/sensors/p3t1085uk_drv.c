@@ -14,7 +14,9 @@
 //-----------------------------------------------------------------------
 #include "p3t1085uk_drv.h"
 #include "systick_utils.h"
+#include "deferred_log.h"
 #include "stdio.h"
+#include "sensor_no_heap.h"
 
 static int32_t P3T1085_I2C_GetTempRegValue(float fTemp, uint8_t * pBuffer)
 {
@@ -57,29 +59,33 @@ static int32_t P3T1085_I2C_GetTempFloatValue(uint8_t * pBuffer, float * fTemp)
     return SENSOR_ERROR_NONE;
 }
 
+static int32_t P3T1085_I2C_GetTempQ4Value(uint8_t * pBuffer, int16_t * pTemp)
+{
+    uint16_t temp = 0;
+
+    temp = (uint16_t)((uint16_t)pBuffer[0] << 8) | (uint16_t)pBuffer[1];
+    /* The 12-bit two's complement code is left aligned, an arithmetic shift keeps the sign. */
+    *pTemp = (int16_t)((int16_t)temp >> P3T1085UK_TEMP_IGNORE_SHIFT);
+
+    return SENSOR_ERROR_NONE;
+}
+
 static int32_t P3T1085_I2C_BlockedWrite_With_Mask(p3t1085_i2c_sensorhandle_t *pSensorHandle, uint16_t offset, uint16_t value, uint16_t mask)
 {
     int32_t status;
-    uint8_t reg[P3T1085UK_REG_SIZE_BYTES];
-    uint16_t actValue = 0;
+    const registerwritelist16_t writeList[] = {{.writeTo = offset, .value = value, .mask = mask}, __END_WRITE_DATA__};
 
-    status = Register_I2C_Read(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo, pSensorHandle->slaveAddress, offset, P3T1085UK_REG_SIZE_BYTES, &reg[0]);
-    if (ARM_DRIVER_OK != status)
+    status = Sensor_I2C_Write16(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo, pSensorHandle->slaveAddress,
+                                writeList, P3T1085UK_BYTES_PER_ADDRESS);
+    if (SENSOR_ERROR_READ == status)
     {
+        DLOG("P3T1085 reg 0x%x read failed\r\n", offset);
         pSensorHandle->isInitialized = false;
         return SENSOR_ERROR_INIT;
     }
-    actValue = (int16_t)((int16_t)reg[0] << 8) | (int16_t)reg[1];
-
-    actValue = (actValue & ~mask) | value;
-    reg[1] = (uint8_t)actValue;
-    reg[0] = (uint8_t)(actValue >> 8);
-
-    status = Register_I2C_BlockWrite(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo, pSensorHandle->slaveAddress,
-                    offset, &reg[0], P3T1085UK_REG_SIZE_BYTES);
-
-    if (ARM_DRIVER_OK != status)
+    if (SENSOR_ERROR_NONE != status)
     {
+        DLOG("P3T1085 reg 0x%x write failed\r\n", offset);
         return SENSOR_ERROR_WRITE;
     }
 
@@ -110,6 +116,70 @@ int32_t P3T1085_I2C_Initialize(
     return SENSOR_ERROR_NONE;
 }
 
+int32_t P3T1085_I2C_Configure(p3t1085_i2c_sensorhandle_t *pSensorHandle, const p3t1085_config_t *pConfig)
+{
+    int32_t status;
+    uint8_t reg[3 * P3T1085UK_REG_SIZE_BYTES];
+    uint16_t actValue;
+    uint32_t i;
+    registerwritelist16_t writeList[4];
+    uint16_t masks[3];
+    const registerreadlist_t readList[] = {{.readFrom = P3T1085UK_TLOW, .numBytes = P3T1085UK_REG_SIZE_BYTES},
+                                           {.readFrom = P3T1085UK_THIGH, .numBytes = P3T1085UK_REG_SIZE_BYTES},
+                                           {.readFrom = P3T1085UK_CONFIG, .numBytes = P3T1085UK_REG_SIZE_BYTES},
+                                           __END_READ_DATA__};
+
+    /*! Validate for the correct handle and configuration.*/
+    if ((pSensorHandle == NULL) || (pConfig == NULL))
+    {
+        return SENSOR_ERROR_INVALID_PARAM;
+    }
+
+    /*! Check whether sensor handle is initialized before applying configuration.*/
+    if (pSensorHandle->isInitialized != true)
+    {
+        return SENSOR_ERROR_INIT;
+    }
+
+    /*! The whole value of each register is known, so every entry overwrites without read-modify-write.*/
+    writeList[0] = (registerwritelist16_t){.writeTo = P3T1085UK_TLOW, .value = pConfig->tlow, .mask = 0};
+    writeList[1] = (registerwritelist16_t){.writeTo = P3T1085UK_THIGH, .value = pConfig->thigh, .mask = 0};
+    writeList[2] = (registerwritelist16_t){.writeTo = P3T1085UK_CONFIG, .value = pConfig->config, .mask = 0};
+    writeList[3] = (registerwritelist16_t)__END_WRITE_DATA__;
+    masks[0]     = P3T1085UK_TEMP_CALC_MASK;
+    masks[1]     = P3T1085UK_TEMP_CALC_MASK;
+    masks[2]     = (uint16_t)~P3T1085UK_CONFIG_RO_MASK;
+
+    status = Sensor_I2C_Write16(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo, pSensorHandle->slaveAddress,
+                                writeList, P3T1085UK_BYTES_PER_ADDRESS);
+    if (SENSOR_ERROR_NONE != status)
+    {
+        DLOG("P3T1085 configuration write failed %d\r\n", status);
+        return SENSOR_ERROR_WRITE;
+    }
+
+    /*! Read back and compare, ignoring the read-only alert flags of CONFIG.*/
+    status = Sensor_I2C_ReadCoalesced(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo, pSensorHandle->slaveAddress,
+                                      readList, P3T1085UK_BYTES_PER_ADDRESS, &reg[0]);
+    if (SENSOR_ERROR_NONE != status)
+    {
+        DLOG("P3T1085 configuration read failed %d\r\n", status);
+        pSensorHandle->isInitialized = false;
+        return SENSOR_ERROR_INIT;
+    }
+    for (i = 0; i < 3U; i++)
+    {
+        actValue = (uint16_t)((uint16_t)reg[2 * i] << 8) | (uint16_t)reg[2 * i + 1];
+        if (((actValue ^ writeList[i].value) & masks[i]) != 0U)
+        {
+            DLOG("P3T1085 reg 0x%x verify 0x%x != 0x%x\r\n", writeList[i].writeTo, actValue, writeList[i].value);
+            return SENSOR_ERROR_WRITE;
+        }
+    }
+
+    return SENSOR_ERROR_NONE;
+}
+
 int32_t P3T1085_I2C_GetTemp(p3t1085_i2c_sensorhandle_t *pSensorHandle, float *pBuffer)
 {
     uint8_t reg[P3T1085UK_REG_SIZE_BYTES];
@@ -130,6 +200,7 @@ int32_t P3T1085_I2C_GetTemp(p3t1085_i2c_sensorhandle_t *pSensorHandle, float *pB
     status = Register_I2C_Read(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo, pSensorHandle->slaveAddress, P3T1085UK_TEMP, P3T1085UK_REG_SIZE_BYTES, &reg[0]);
     if (ARM_DRIVER_OK != status)
     {
+	DLOG("P3T1085 TEMP read failed %d\r\n", status);
 	pSensorHandle->isInitialized = false;
 	return SENSOR_ERROR_INIT;
     }
@@ -138,6 +209,80 @@ int32_t P3T1085_I2C_GetTemp(p3t1085_i2c_sensorhandle_t *pSensorHandle, float *pB
     return SENSOR_ERROR_NONE;
 }
 
+int32_t P3T1085_I2C_GetTempQ4(p3t1085_i2c_sensorhandle_t *pSensorHandle, int16_t *pBuffer)
+{
+    uint8_t reg[P3T1085UK_REG_SIZE_BYTES];
+    int32_t status;
+
+    /*! Validate for the correct handle and output buffer.*/
+    if ((pSensorHandle == NULL) || (pBuffer == NULL))
+    {
+        return SENSOR_ERROR_INVALID_PARAM;
+    }
+
+    /*! Check whether sensor handle is initialized before reading sensor data.*/
+    if (pSensorHandle->isInitialized != true)
+    {
+        return SENSOR_ERROR_INIT;
+    }
+    /*!  Read and store the device's Temp register.*/
+    status = Register_I2C_Read(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo, pSensorHandle->slaveAddress, P3T1085UK_TEMP, P3T1085UK_REG_SIZE_BYTES, &reg[0]);
+    if (ARM_DRIVER_OK != status)
+    {
+        DLOG("P3T1085 TEMP read failed %d\r\n", status);
+        pSensorHandle->isInitialized = false;
+        return SENSOR_ERROR_INIT;
+    }
+    P3T1085_I2C_GetTempQ4Value(&reg[0], pBuffer);
+    DLOG("P3T1085 TEMP %.4T\r\n", *pBuffer);
+
+    return SENSOR_ERROR_NONE;
+}
+
+int32_t P3T1085_I2C_StartTempRead(p3t1085_i2c_sensorhandle_t *pSensorHandle,
+                                  uint8_t *pRaw,
+                                  registerAsyncCallback_t callback,
+                                  void *pUserData)
+{
+    int32_t status;
+
+    /*! Validate for the correct handle, output buffer and callback.*/
+    if ((pSensorHandle == NULL) || (pRaw == NULL) || (callback == NULL))
+    {
+        return SENSOR_ERROR_INVALID_PARAM;
+    }
+
+    /*! Check whether sensor handle is initialized before reading sensor data.*/
+    if (pSensorHandle->isInitialized != true)
+    {
+        return SENSOR_ERROR_INIT;
+    }
+
+    /*! Start reading the device's Temp register, the callback completes it.*/
+    status = Register_I2C_ReadAsync(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo, pSensorHandle->slaveAddress,
+                                    P3T1085UK_TEMP, P3T1085UK_REG_SIZE_BYTES, pRaw, callback, pUserData);
+    if (ARM_DRIVER_ERROR_BUSY == status)
+    {
+        return SENSOR_ERROR_BUSY;
+    }
+    if (ARM_DRIVER_OK != status)
+    {
+        DLOG("P3T1085 TEMP async read failed %d\r\n", status);
+        return SENSOR_ERROR_READ;
+    }
+
+    return SENSOR_ERROR_NONE;
+}
+
+SENSOR_RAMFUNC int16_t P3T1085_I2C_TempRawToQ4(const uint8_t *pRaw)
+{
+    int16_t temp;
+
+    P3T1085_I2C_GetTempQ4Value((uint8_t *)pRaw, &temp);
+
+    return temp;
+}
+
 int32_t P3T1085_I2C_GetTHigh(p3t1085_i2c_sensorhandle_t *pSensorHandle, float *pBuffer)
 {
     int32_t status;
@@ -223,6 +368,33 @@ int32_t P3T1085_I2C_WriteData(p3t1085_i2c_sensorhandle_t *pSensorHandle, const r
     return SENSOR_ERROR_NONE;
 }
 
+int32_t P3T1085_I2C_WriteData16(p3t1085_i2c_sensorhandle_t *pSensorHandle, const registerwritelist16_t *pRegWriteList)
+{
+    int32_t status;
+
+    /*! Validate for the correct handle and register write list.*/
+    if ((pSensorHandle == NULL) || (pRegWriteList == NULL))
+    {
+        return SENSOR_ERROR_INVALID_PARAM;
+    }
+
+    /*! Check whether sensor handle is initialized before applying configuration.*/
+    if (pSensorHandle->isInitialized != true)
+    {
+        return SENSOR_ERROR_INIT;
+    }
+
+    /*! Apply the Sensor Configuration based on the Register Write List */
+    status = Sensor_I2C_Write16(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo, pSensorHandle->slaveAddress,
+                                pRegWriteList, P3T1085UK_BYTES_PER_ADDRESS);
+    if (ARM_DRIVER_OK != status)
+    {
+        return SENSOR_ERROR_WRITE;
+    }
+
+    return SENSOR_ERROR_NONE;
+}
+
 int32_t P3T1085_I2C_ReadData(p3t1085_i2c_sensorhandle_t *pSensorHandle,
                               const registerreadlist_t *pReadList,
                               uint8_t *pBuffer)
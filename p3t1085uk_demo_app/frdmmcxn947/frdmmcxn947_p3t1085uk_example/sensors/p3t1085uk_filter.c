@@ -0,0 +1,189 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file p3t1085uk_filter.c
+ * @brief The p3t1085uk_filter.c file implements the P3T1085UK temperature filter chain.
+ */
+
+//-----------------------------------------------------------------------
+// ISSDK Includes
+//-----------------------------------------------------------------------
+#include "fsl_common.h"
+#include "p3t1085uk_filter.h"
+#include "sensor_no_heap.h"
+
+//-----------------------------------------------------------------------
+// Macros
+//-----------------------------------------------------------------------
+/* Fractional bits kept by the IIR, without them small steps would never reach the output. */
+#define P3T1085_FILTER_IIR_SHIFT   (8)
+#define P3T1085_FILTER_IIR_Q       (15)
+#define P3T1085_FILTER_BOXCAR_Q    (24)
+
+//-----------------------------------------------------------------------
+// Functions
+//-----------------------------------------------------------------------
+/* Fill a stage with one reading, as if it had been read forever. */
+static void P3T1085_Filter_Prime(p3t1085_filter_stage_t *pStage, int16_t tempQ4)
+{
+    for (uint8_t i = 0; i < pStage->length; i++)
+    {
+        pStage->history[i] = tempQ4;
+        pStage->sorted[i] = tempQ4;
+    }
+    pStage->next = 0U;
+    pStage->acc = (pStage->type == P3T1085_FILTER_TYPE_IIR) ? ((int32_t)tempQ4 * (1 << P3T1085_FILTER_IIR_SHIFT))
+                                                             : ((int32_t)tempQ4 * pStage->length);
+}
+
+/* Replace the oldest reading of the sorted window with the new one, shifting the readings between. */
+static int16_t P3T1085_Filter_Median(p3t1085_filter_stage_t *pStage, int16_t tempQ4, int16_t oldest)
+{
+    int16_t *pSorted = pStage->sorted;
+    uint8_t i = 0U;
+
+    while (pSorted[i] != oldest)
+    {
+        i++;
+    }
+    while ((i + 1U < pStage->length) && (pSorted[i + 1U] < tempQ4))
+    {
+        pSorted[i] = pSorted[i + 1U];
+        i++;
+    }
+    while ((i > 0U) && (pSorted[i - 1U] > tempQ4))
+    {
+        pSorted[i] = pSorted[i - 1U];
+        i--;
+    }
+    pSorted[i] = tempQ4;
+
+    return pSorted[pStage->length / 2U];
+}
+
+int32_t P3T1085_Filter_Init(p3t1085_filter_t *pFilter,
+                            p3t1085_i2c_sensorhandle_t *pSensorHandle,
+                            const p3t1085_filter_stage_config_t *pStages,
+                            uint8_t stageCount)
+{
+    p3t1085_filter_stage_t *pStage;
+
+    /*! Check the input parameters. */
+    if ((pFilter == NULL) || (pStages == NULL) || (stageCount == 0U) || (stageCount > P3T1085_FILTER_MAX_STAGES))
+    {
+        return SENSOR_ERROR_INVALID_PARAM;
+    }
+
+    for (uint8_t i = 0; i < stageCount; i++)
+    {
+        pStage = &pFilter->stages[i];
+        pStage->type = pStages[i].type;
+        pStage->length = 1U;
+        switch (pStages[i].type)
+        {
+            case P3T1085_FILTER_TYPE_MEDIAN:
+            case P3T1085_FILTER_TYPE_BOXCAR:
+                if ((pStages[i].param == 0U) || (pStages[i].param > P3T1085_FILTER_MAX_LENGTH))
+                {
+                    return SENSOR_ERROR_INVALID_PARAM;
+                }
+                pStage->length = (uint8_t)pStages[i].param;
+                /* The reciprocal in Q24 divides a sum of 12-bit readings with an error far below one step,
+                 * only an exact half may round away from zero instead of up. */
+                pStage->coeff = ((1UL << P3T1085_FILTER_BOXCAR_Q) + pStage->length / 2U) / pStage->length;
+                break;
+            case P3T1085_FILTER_TYPE_IIR:
+                if ((pStages[i].param == 0U) || (pStages[i].param > (1U << P3T1085_FILTER_IIR_Q)))
+                {
+                    return SENSOR_ERROR_INVALID_PARAM;
+                }
+                pStage->coeff = pStages[i].param;
+                break;
+            default:
+                return SENSOR_ERROR_INVALID_PARAM;
+        }
+    }
+
+    pFilter->pSensorHandle = pSensorHandle;
+    pFilter->stageCount = stageCount;
+    pFilter->primed = false;
+
+    return SENSOR_ERROR_NONE;
+}
+
+void P3T1085_Filter_Reset(p3t1085_filter_t *pFilter)
+{
+    pFilter->primed = false;
+}
+
+int16_t P3T1085_Filter_Process(p3t1085_filter_t *pFilter, int16_t tempQ4)
+{
+    p3t1085_filter_stage_t *pStage;
+    int16_t oldest;
+
+    for (uint8_t i = 0; i < pFilter->stageCount; i++)
+    {
+        pStage = &pFilter->stages[i];
+        if (!pFilter->primed)
+        {
+            P3T1085_Filter_Prime(pStage, tempQ4);
+            continue;
+        }
+
+        oldest = pStage->history[pStage->next];
+        pStage->history[pStage->next] = tempQ4;
+        pStage->next = (pStage->next + 1U == pStage->length) ? 0U : (uint8_t)(pStage->next + 1U);
+
+        switch (pStage->type)
+        {
+            case P3T1085_FILTER_TYPE_MEDIAN:
+                tempQ4 = P3T1085_Filter_Median(pStage, tempQ4, oldest);
+                break;
+            case P3T1085_FILTER_TYPE_BOXCAR:
+                pStage->acc += (int32_t)tempQ4 - (int32_t)oldest;
+                tempQ4 = (int16_t)(((int64_t)pStage->acc * pStage->coeff + (1LL << (P3T1085_FILTER_BOXCAR_Q - 1))) >>
+                                   P3T1085_FILTER_BOXCAR_Q);
+                break;
+            default:
+                /* y += a * (x - y), rounded, with y kept with P3T1085_FILTER_IIR_SHIFT more bits. */
+                pStage->acc += (int32_t)(((int64_t)((int32_t)tempQ4 * (1 << P3T1085_FILTER_IIR_SHIFT) - pStage->acc) *
+                                              pStage->coeff + (1LL << (P3T1085_FILTER_IIR_Q - 1))) >>
+                                         P3T1085_FILTER_IIR_Q);
+                tempQ4 = (int16_t)((pStage->acc + (1 << (P3T1085_FILTER_IIR_SHIFT - 1))) >> P3T1085_FILTER_IIR_SHIFT);
+                break;
+        }
+    }
+    pFilter->primed = true;
+
+    return tempQ4;
+}
+
+int32_t P3T1085_Filter_GetTempQ4(p3t1085_filter_t *pFilter, int16_t *pRawQ4, int16_t *pFilteredQ4)
+{
+    int16_t tempQ4;
+    int32_t status;
+
+    /*! Validate for the correct filter and output buffer.*/
+    if ((pFilter == NULL) || (pFilteredQ4 == NULL))
+    {
+        return SENSOR_ERROR_INVALID_PARAM;
+    }
+
+    status = P3T1085_I2C_GetTempQ4(pFilter->pSensorHandle, &tempQ4);
+    if (SENSOR_ERROR_NONE != status)
+    {
+        return status;
+    }
+
+    if (pRawQ4 != NULL)
+    {
+        *pRawQ4 = tempQ4;
+    }
+    *pFilteredQ4 = P3T1085_Filter_Process(pFilter, tempQ4);
+
+    return SENSOR_ERROR_NONE;
+}
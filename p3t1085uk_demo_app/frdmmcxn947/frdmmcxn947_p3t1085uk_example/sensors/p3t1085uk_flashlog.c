@@ -0,0 +1,486 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file p3t1085uk_flashlog.c
+ * @brief The p3t1085uk_flashlog.c file implements the P3T1085UK log-structured flash store.
+ */
+
+//-----------------------------------------------------------------------
+// Standard C Includes
+//-----------------------------------------------------------------------
+#include <string.h>
+
+//-----------------------------------------------------------------------
+// ISSDK Includes
+//-----------------------------------------------------------------------
+#include "sensor_drv.h"
+#include "p3t1085uk_crc.h"
+#include "p3t1085uk_flashlog.h"
+#include "sensor_no_heap.h"
+
+//-----------------------------------------------------------------------
+// Macros
+//-----------------------------------------------------------------------
+/* Page header: sequence number, time of a record or first record sequence number of a sector,
+ * page type, payload length and CRC-32 of the header fields and the payload, little-endian. */
+#define P3T1085_FLASHLOG_SEQ_OFFSET    (0U)
+#define P3T1085_FLASHLOG_VALUE_OFFSET  (4U)
+#define P3T1085_FLASHLOG_TYPE_OFFSET   (8U)
+#define P3T1085_FLASHLOG_LENGTH_OFFSET (10U)
+#define P3T1085_FLASHLOG_CRC_OFFSET    (12U)
+
+#define P3T1085_FLASHLOG_TYPE_SECTOR (0x5343U) /* Payload: erase count. */
+#define P3T1085_FLASHLOG_TYPE_RECORD (0x5243U)
+
+//-----------------------------------------------------------------------
+// Functions
+//-----------------------------------------------------------------------
+static void P3T1085_FlashLog_Put32(uint8_t *p, uint32_t value)
+{
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+    p[2] = (uint8_t)(value >> 16);
+    p[3] = (uint8_t)(value >> 24);
+}
+
+static uint32_t P3T1085_FlashLog_Get32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t P3T1085_FlashLog_Get16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | ((uint16_t)p[1] << 8));
+}
+
+static uint32_t P3T1085_FlashLog_Address(const p3t1085_flashlog_t *pLog, uint32_t sector, uint32_t page)
+{
+    return pLog->pFlash->base + sector * pLog->pFlash->sectorSize + page * pLog->pFlash->pageSize;
+}
+
+/* Sector of the i-th used sector from the oldest. */
+static uint32_t P3T1085_FlashLog_Sector(const p3t1085_flashlog_t *pLog, uint32_t i)
+{
+    i += pLog->oldest;
+    return (i >= pLog->sectorCount) ? i - pLog->sectorCount : i;
+}
+
+/* Fill a page buffer with its header and payload, the rest stays erased. */
+static void P3T1085_FlashLog_Build(const p3t1085_flashlog_t *pLog,
+                                   uint8_t *pPage,
+                                   uint32_t seq,
+                                   uint32_t value,
+                                   uint16_t type,
+                                   const uint8_t *pData,
+                                   uint16_t length)
+{
+    memset(pPage, 0xFF, pLog->pFlash->pageSize);
+    P3T1085_FlashLog_Put32(&pPage[P3T1085_FLASHLOG_SEQ_OFFSET], seq);
+    P3T1085_FlashLog_Put32(&pPage[P3T1085_FLASHLOG_VALUE_OFFSET], value);
+    P3T1085_FlashLog_Put32(&pPage[P3T1085_FLASHLOG_TYPE_OFFSET], (uint32_t)type | ((uint32_t)length << 16));
+    memcpy(&pPage[P3T1085_FLASHLOG_HEADER_SIZE], pData, length);
+    P3T1085_FlashLog_Put32(&pPage[P3T1085_FLASHLOG_CRC_OFFSET],
+                           P3T1085_Crc32(P3T1085_Crc32(0U, pPage, P3T1085_FLASHLOG_CRC_OFFSET),
+                                         &pPage[P3T1085_FLASHLOG_HEADER_SIZE], length));
+}
+
+/* Read a page and check it is a complete page of the given type. */
+static bool P3T1085_FlashLog_ReadPage(
+    const p3t1085_flashlog_t *pLog, uint32_t sector, uint32_t page, uint16_t type, uint8_t *pPage)
+{
+    uint16_t length;
+
+    if (SENSOR_ERROR_NONE != pLog->pFlash->read(pLog->pFlash->pContext, P3T1085_FlashLog_Address(pLog, sector, page),
+                                                pPage, pLog->pFlash->pageSize))
+    {
+        return false;
+    }
+
+    length = P3T1085_FlashLog_Get16(&pPage[P3T1085_FLASHLOG_LENGTH_OFFSET]);
+    return (P3T1085_FlashLog_Get16(&pPage[P3T1085_FLASHLOG_TYPE_OFFSET]) == type) &&
+           (length <= pLog->pFlash->pageSize - P3T1085_FLASHLOG_HEADER_SIZE) &&
+           (P3T1085_FlashLog_Get32(&pPage[P3T1085_FLASHLOG_CRC_OFFSET]) ==
+            P3T1085_Crc32(P3T1085_Crc32(0U, pPage, P3T1085_FLASHLOG_CRC_OFFSET), &pPage[P3T1085_FLASHLOG_HEADER_SIZE],
+                          length));
+}
+
+static bool P3T1085_FlashLog_ReadRecord(const p3t1085_flashlog_t *pLog,
+                                        uint32_t sector,
+                                        uint32_t page,
+                                        p3t1085_flashlog_record_t *pRecord,
+                                        uint8_t *pData)
+{
+    uint8_t buffer[P3T1085_FLASHLOG_MAX_PAGE_SIZE];
+
+    if (!P3T1085_FlashLog_ReadPage(pLog, sector, page, P3T1085_FLASHLOG_TYPE_RECORD, buffer))
+    {
+        return false;
+    }
+
+    pRecord->address = P3T1085_FlashLog_Address(pLog, sector, page);
+    pRecord->seq = P3T1085_FlashLog_Get32(&buffer[P3T1085_FLASHLOG_SEQ_OFFSET]);
+    pRecord->timeMs = P3T1085_FlashLog_Get32(&buffer[P3T1085_FLASHLOG_VALUE_OFFSET]);
+    pRecord->length = P3T1085_FlashLog_Get16(&buffer[P3T1085_FLASHLOG_LENGTH_OFFSET]);
+    if (pData != NULL)
+    {
+        memcpy(pData, &buffer[P3T1085_FLASHLOG_HEADER_SIZE], pRecord->length);
+    }
+
+    return true;
+}
+
+/* Newest valid record of a sector. */
+static bool P3T1085_FlashLog_ReadNewest(const p3t1085_flashlog_t *pLog,
+                                        uint32_t sector,
+                                        p3t1085_flashlog_record_t *pRecord)
+{
+    for (uint32_t page = pLog->pagesPerSector - 1U; page > 0U; page--)
+    {
+        if (P3T1085_FlashLog_ReadRecord(pLog, sector, page, pRecord, NULL))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/* Time of the first record of the i-th used sector, or of the closest older sector with a record. */
+static uint32_t P3T1085_FlashLog_FirstTime(const p3t1085_flashlog_t *pLog, uint32_t i)
+{
+    while (pLog->sectors[P3T1085_FlashLog_Sector(pLog, i)].empty && (i > 0U))
+    {
+        i--;
+    }
+
+    return pLog->sectors[P3T1085_FlashLog_Sector(pLog, i)].firstTimeMs;
+}
+
+/* Erase the next sector, reclaiming the oldest one when the region is full, and write its header. */
+static int32_t P3T1085_FlashLog_OpenSector(p3t1085_flashlog_t *pLog)
+{
+    uint8_t page[P3T1085_FLASHLOG_MAX_PAGE_SIZE];
+    uint8_t eraseCount[4];
+    uint32_t sector;
+    int32_t status;
+
+    if (pLog->usedSectors == pLog->sectorCount)
+    {
+        pLog->oldest = P3T1085_FlashLog_Sector(pLog, 1U);
+        pLog->usedSectors--;
+    }
+    sector = P3T1085_FlashLog_Sector(pLog, pLog->usedSectors);
+
+    pLog->sectors[sector].seq = 0U;
+    pLog->sectors[sector].eraseCount++;
+    pLog->eraseCount++;
+    status = pLog->pFlash->erase(pLog->pFlash->pContext, P3T1085_FlashLog_Address(pLog, sector, 0U));
+    if (SENSOR_ERROR_NONE != status)
+    {
+        return status;
+    }
+
+    P3T1085_FlashLog_Put32(eraseCount, pLog->sectors[sector].eraseCount);
+    P3T1085_FlashLog_Build(pLog, page, pLog->sectorSeq + 1U, pLog->recordSeq, P3T1085_FLASHLOG_TYPE_SECTOR, eraseCount,
+                           sizeof(eraseCount));
+    pLog->programCount++;
+    status = pLog->pFlash->program(pLog->pFlash->pContext, P3T1085_FlashLog_Address(pLog, sector, 0U), page);
+    if (SENSOR_ERROR_NONE != status)
+    {
+        return status;
+    }
+
+    pLog->sectorSeq++;
+    pLog->sectors[sector].seq = pLog->sectorSeq;
+    pLog->sectors[sector].empty = true;
+    pLog->usedSectors++;
+    pLog->nextPage = 1U;
+
+    return SENSOR_ERROR_NONE;
+}
+
+int32_t P3T1085_FlashLog_Mount(p3t1085_flashlog_t *pLog, const p3t1085_flash_t *pFlash)
+{
+    uint8_t buffer[P3T1085_FLASHLOG_MAX_PAGE_SIZE];
+    p3t1085_flashlog_record_t record;
+    p3t1085_flashlog_sector_t *pSector;
+    uint32_t head = 0U;
+    uint32_t sector;
+    uint32_t page;
+    uint32_t firstRecordSeq = 1U;
+
+    /*! Check the input parameters. */
+    if ((pLog == NULL) || (pFlash == NULL) || (pFlash->pageSize <= P3T1085_FLASHLOG_HEADER_SIZE) ||
+        (pFlash->pageSize > P3T1085_FLASHLOG_MAX_PAGE_SIZE) || (pFlash->sectorSize < 2U * pFlash->pageSize) ||
+        ((pFlash->sectorSize % pFlash->pageSize) != 0U) || ((pFlash->size % pFlash->sectorSize) != 0U) ||
+        (pFlash->size / pFlash->sectorSize < 2U) || (pFlash->size / pFlash->sectorSize > P3T1085_FLASHLOG_MAX_SECTORS))
+    {
+        return SENSOR_ERROR_INVALID_PARAM;
+    }
+
+    memset(pLog, 0, sizeof(*pLog));
+    pLog->pFlash = pFlash;
+    pLog->sectorCount = pFlash->size / pFlash->sectorSize;
+    pLog->pagesPerSector = pFlash->sectorSize / pFlash->pageSize;
+    pLog->nextPage = pLog->pagesPerSector;
+    pLog->recordSeq = 1U;
+
+    /*! Read the sector headers, the newest sector is the written one. */
+    for (sector = 0U; sector < pLog->sectorCount; sector++)
+    {
+        pSector = &pLog->sectors[sector];
+        if (P3T1085_FlashLog_ReadPage(pLog, sector, 0U, P3T1085_FLASHLOG_TYPE_SECTOR, buffer))
+        {
+            pSector->seq = P3T1085_FlashLog_Get32(&buffer[P3T1085_FLASHLOG_SEQ_OFFSET]);
+            pSector->eraseCount = P3T1085_FlashLog_Get32(&buffer[P3T1085_FLASHLOG_HEADER_SIZE]);
+            if (pSector->seq > pLog->sectorSeq)
+            {
+                pLog->sectorSeq = pSector->seq;
+                firstRecordSeq = P3T1085_FlashLog_Get32(&buffer[P3T1085_FLASHLOG_VALUE_OFFSET]);
+                head = sector;
+            }
+        }
+    }
+    if (pLog->sectorSeq == 0U)
+    {
+        return SENSOR_ERROR_NONE;
+    }
+
+    /*! Walk back from the newest sector while the sequence numbers follow. */
+    pLog->oldest = head;
+    pLog->usedSectors = 1U;
+    while (pLog->usedSectors < pLog->sectorCount)
+    {
+        sector = (pLog->oldest == 0U) ? pLog->sectorCount - 1U : pLog->oldest - 1U;
+        if ((pLog->sectors[sector].seq == 0U) ||
+            (pLog->sectors[sector].seq != pLog->sectors[pLog->oldest].seq - 1U))
+        {
+            break;
+        }
+        pLog->oldest = sector;
+        pLog->usedSectors++;
+    }
+    /*! Appends go on after the newest record of the written sector. */
+    if (P3T1085_FlashLog_ReadNewest(pLog, head, &record))
+    {
+        pLog->recordSeq = record.seq + 1U;
+        pLog->lastTimeMs = record.timeMs;
+        page = (record.address - P3T1085_FlashLog_Address(pLog, head, 0U)) / pFlash->pageSize + 1U;
+    }
+    else
+    {
+        pLog->recordSeq = firstRecordSeq;
+        page = 1U;
+        if ((pLog->usedSectors > 1U) &&
+            P3T1085_FlashLog_ReadNewest(pLog, P3T1085_FlashLog_Sector(pLog, pLog->usedSectors - 2U), &record))
+        {
+            pLog->lastTimeMs = record.timeMs;
+        }
+    }
+    /*! A program cut at its start may leave a page that reads as erased but cannot be programmed
+     *  again, the pages past the newest record are checked with the blank function and the torn
+     *  ones are skipped. Without a blank function the next append opens a new sector, except
+     *  after a written sector without record, which is opened again so that resets before the
+     *  first append do not reclaim the oldest records. */
+    pLog->nextPage = pLog->pagesPerSector;
+    if (pFlash->blank != NULL)
+    {
+        while ((page < pLog->pagesPerSector) &&
+               (SENSOR_ERROR_NONE != pFlash->blank(pFlash->pContext, P3T1085_FlashLog_Address(pLog, head, page))))
+        {
+            page++;
+        }
+        pLog->nextPage = page;
+    }
+    else if (page == 1U)
+    {
+        pLog->usedSectors--;
+        pLog->sectorSeq--;
+    }
+
+    /*! Index the sectors by the time of their first record. */
+    for (uint32_t i = 0U; i < pLog->usedSectors; i++)
+    {
+        sector = P3T1085_FlashLog_Sector(pLog, i);
+        pSector = &pLog->sectors[sector];
+        pSector->empty = true;
+        for (uint32_t j = 1U; (j < pLog->pagesPerSector) && pSector->empty; j++)
+        {
+            if (P3T1085_FlashLog_ReadRecord(pLog, sector, j, &record, NULL))
+            {
+                pSector->firstTimeMs = record.timeMs;
+                pSector->empty = false;
+            }
+        }
+    }
+
+    return SENSOR_ERROR_NONE;
+}
+
+int32_t P3T1085_FlashLog_Append(p3t1085_flashlog_t *pLog, uint32_t timeMs, const uint8_t *pData, uint16_t length)
+{
+    uint8_t page[P3T1085_FLASHLOG_MAX_PAGE_SIZE];
+    p3t1085_flashlog_sector_t *pSector;
+    uint32_t sector;
+    int32_t status;
+
+    /*! Check the input parameters. */
+    if ((pLog == NULL) || (pLog->pFlash == NULL) || ((pData == NULL) && (length != 0U)) ||
+        (length > pLog->pFlash->pageSize - P3T1085_FLASHLOG_HEADER_SIZE))
+    {
+        return SENSOR_ERROR_INVALID_PARAM;
+    }
+
+    if (pLog->nextPage >= pLog->pagesPerSector)
+    {
+        status = P3T1085_FlashLog_OpenSector(pLog);
+        if (SENSOR_ERROR_NONE != status)
+        {
+            return status;
+        }
+    }
+
+    sector = P3T1085_FlashLog_Sector(pLog, pLog->usedSectors - 1U);
+    P3T1085_FlashLog_Build(pLog, page, pLog->recordSeq, timeMs, P3T1085_FLASHLOG_TYPE_RECORD, pData, length);
+    pLog->programCount++;
+    status = pLog->pFlash->program(pLog->pFlash->pContext, P3T1085_FlashLog_Address(pLog, sector, pLog->nextPage), page);
+    pLog->nextPage++;
+    if (SENSOR_ERROR_NONE != status)
+    {
+        return status;
+    }
+
+    pSector = &pLog->sectors[sector];
+    if (pSector->empty)
+    {
+        pSector->firstTimeMs = timeMs;
+        pSector->empty = false;
+    }
+    pLog->recordSeq++;
+    pLog->lastTimeMs = timeMs;
+
+    return SENSOR_ERROR_NONE;
+}
+
+int32_t P3T1085_FlashLog_Read(const p3t1085_flashlog_t *pLog,
+                              uint32_t *pAddress,
+                              p3t1085_flashlog_record_t *pRecord,
+                              uint8_t *pData)
+{
+    uint32_t i = 0U;
+    uint32_t page = 1U;
+    uint32_t offset;
+    uint32_t sector;
+    uint32_t limit;
+
+    if ((pLog == NULL) || (pAddress == NULL) || (pRecord == NULL) || (pLog->usedSectors == 0U))
+    {
+        return SENSOR_ERROR_INVALID_PARAM;
+    }
+
+    if (*pAddress != P3T1085_FLASHLOG_OLDEST)
+    {
+        offset = *pAddress - pLog->pFlash->base;
+        if ((*pAddress < pLog->pFlash->base) || (offset >= pLog->pFlash->size))
+        {
+            return SENSOR_ERROR_INVALID_PARAM;
+        }
+        sector = offset / pLog->pFlash->sectorSize;
+        page = ((offset % pLog->pFlash->sectorSize) + pLog->pFlash->pageSize - 1U) / pLog->pFlash->pageSize;
+        page = (page == 0U) ? 1U : page;
+        i = (sector + pLog->sectorCount - pLog->oldest) % pLog->sectorCount;
+    }
+
+    for (; i < pLog->usedSectors; i++, page = 1U)
+    {
+        sector = P3T1085_FlashLog_Sector(pLog, i);
+        limit = (i == pLog->usedSectors - 1U) ? pLog->nextPage : pLog->pagesPerSector;
+        for (; page < limit; page++)
+        {
+            if (P3T1085_FlashLog_ReadRecord(pLog, sector, page, pRecord, pData))
+            {
+                *pAddress = pRecord->address;
+                return SENSOR_ERROR_NONE;
+            }
+        }
+    }
+
+    return SENSOR_ERROR_INVALID_PARAM;
+}
+
+int32_t P3T1085_FlashLog_Find(const p3t1085_flashlog_t *pLog, uint32_t timeMs, uint32_t *pAddress)
+{
+    const p3t1085_flashlog_sector_t *pSector;
+    p3t1085_flashlog_record_t record;
+    uint32_t baseMs = 0U;
+    uint32_t first = 0U;
+    uint32_t lo;
+    uint32_t hi;
+    uint32_t mid;
+    uint32_t limit;
+    uint32_t sector;
+    bool found = false;
+
+    if ((pLog == NULL) || (pAddress == NULL))
+    {
+        return SENSOR_ERROR_INVALID_PARAM;
+    }
+
+    /*! Times are compared as offsets from the oldest record, so they may wrap once. */
+    while ((first < pLog->usedSectors) && pLog->sectors[P3T1085_FlashLog_Sector(pLog, first)].empty)
+    {
+        first++;
+    }
+    if (first == pLog->usedSectors)
+    {
+        return SENSOR_ERROR_INVALID_PARAM;
+    }
+    baseMs = pLog->sectors[P3T1085_FlashLog_Sector(pLog, first)].firstTimeMs;
+    if ((int32_t)(timeMs - baseMs) < 0)
+    {
+        return SENSOR_ERROR_INVALID_PARAM;
+    }
+
+    /*! Newest sector starting at or before the time, a sector without record sorts with the previous one. */
+    lo = first;
+    hi = pLog->usedSectors - 1U;
+    while (lo < hi)
+    {
+        mid = (lo + hi + 1U) / 2U;
+        if (P3T1085_FlashLog_FirstTime(pLog, mid) - baseMs <= timeMs - baseMs)
+        {
+            lo = mid;
+        }
+        else
+        {
+            hi = mid - 1U;
+        }
+    }
+    while (pLog->sectors[P3T1085_FlashLog_Sector(pLog, lo)].empty)
+    {
+        lo--;
+    }
+
+    /*! Newest record of the sector at or before the time. */
+    sector = P3T1085_FlashLog_Sector(pLog, lo);
+    pSector = &pLog->sectors[sector];
+    limit = (lo == pLog->usedSectors - 1U) ? pLog->nextPage : pLog->pagesPerSector;
+    for (uint32_t page = 1U; (page < limit) && !pSector->empty; page++)
+    {
+        if (P3T1085_FlashLog_ReadRecord(pLog, sector, page, &record, NULL))
+        {
+            if ((record.timeMs - baseMs) > (timeMs - baseMs))
+            {
+                break;
+            }
+            *pAddress = record.address;
+            found = true;
+        }
+    }
+
+    return found ? SENSOR_ERROR_NONE : SENSOR_ERROR_INVALID_PARAM;
+}
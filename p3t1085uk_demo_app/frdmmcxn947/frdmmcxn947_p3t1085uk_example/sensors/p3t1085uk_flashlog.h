@@ -0,0 +1,170 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file p3t1085uk_flashlog.h
+ * @brief The p3t1085uk_flashlog.h file describes the P3T1085UK log-structured flash store.
+
+    The store appends records, for example the blocks closed by the compressed sample log, to
+    a flash region used as a circle of sectors. Each record takes one program page: a 16-byte
+    header with a sequence number, a time and a CRC-32, then the payload. The first page of a
+    sector holds its own header with the sector sequence number and erase count. Sectors are
+    filled and erased strictly in turn, so every sector sees the same number of erases, and the
+    oldest sector is the one reclaimed.
+
+    Nothing is ever rewritten in place, which makes the store safe against a power loss at any
+    point: a page torn by a reset fails its CRC or its read and is skipped, a sector whose erase
+    or header write was cut has no valid header and is taken as free. Mounting reads the sector
+    headers, the first record of each sector and the pages of the newest one. Appends then go on
+    in the newest sector, from the first page past its newest record that the blank function of
+    the region finds erased: a page whose program was cut early may read as erased and still not
+    be programmable. A region without blank function opens a new sector at the first append after
+    a mount. Sectors are searched by the time of their first record and then scanned page by page,
+    so a time lookup reads a few headers instead of the log.
+
+    tools/flashlog_sim.c runs the store on a simulated flash with random power cuts.
+*/
+
+#ifndef P3T1085UK_FLASHLOG_H_
+#define P3T1085UK_FLASHLOG_H_
+
+/* Standard C Includes */
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief Maximum number of sectors of a store. */
+#ifndef P3T1085_FLASHLOG_MAX_SECTORS
+#define P3T1085_FLASHLOG_MAX_SECTORS 128
+#endif
+
+/*! @brief Maximum program page size. */
+#ifndef P3T1085_FLASHLOG_MAX_PAGE_SIZE
+#define P3T1085_FLASHLOG_MAX_PAGE_SIZE 256
+#endif
+
+/*! @brief Size of the page header, the payload of a record is the rest of the page. */
+#define P3T1085_FLASHLOG_HEADER_SIZE (16)
+
+/*! @brief Address to start P3T1085_FlashLog_Read() from the oldest record. */
+#define P3T1085_FLASHLOG_OLDEST (0xFFFFFFFFU)
+
+/*!
+ * @brief This defines the flash region of a store and its access functions.
+ *        The functions return the SENSOR_ERROR_* status, addresses are absolute.
+ */
+typedef struct
+{
+    int32_t (*erase)(void *pContext, uint32_t address);                        /*!< Erase one sector to 0xFF. */
+    int32_t (*program)(void *pContext, uint32_t address, const uint8_t *pData); /*!< Program one erased page. */
+    int32_t (*read)(void *pContext, uint32_t address, uint8_t *pData, uint32_t size);
+    int32_t (*blank)(void *pContext, uint32_t address);                        /*!< Check one page is programmable, may be NULL. */
+    void *pContext;
+    uint32_t base;                /*!< Start of the region, sector aligned. */
+    uint32_t size;                /*!< Size of the region, a multiple of the sector size. */
+    uint32_t sectorSize;          /*!< Erase unit. */
+    uint32_t pageSize;            /*!< Program unit. */
+} p3t1085_flash_t;
+
+/*!
+ * @brief This defines what the store knows of a sector.
+ */
+typedef struct
+{
+    uint32_t seq;                 /*!< Sector sequence number, 0 for a free sector. */
+    uint32_t eraseCount;          /*!< Erases of the sector. */
+    uint32_t firstTimeMs;         /*!< Time of the first record. */
+    bool empty;                   /*!< No valid record. */
+} p3t1085_flashlog_sector_t;
+
+/*!
+ * @brief This defines a record read from the store.
+ */
+typedef struct
+{
+    uint32_t address;             /*!< Page of the record. */
+    uint32_t seq;                 /*!< Record sequence number, increasing by one per append. */
+    uint32_t timeMs;              /*!< Time given to P3T1085_FlashLog_Append(). */
+    uint16_t length;              /*!< Payload length. */
+} p3t1085_flashlog_record_t;
+
+/*!
+ * @brief This defines the store state.
+ */
+typedef struct
+{
+    const p3t1085_flash_t *pFlash;
+    uint32_t sectorCount;
+    uint32_t pagesPerSector;
+    uint32_t oldest;              /*!< Oldest used sector. */
+    uint32_t usedSectors;         /*!< Used sectors from the oldest, the last one is written. */
+    uint32_t nextPage;            /*!< Next page of the written sector. */
+    uint32_t sectorSeq;           /*!< Sequence number of the written sector, 0 when the store is empty. */
+    uint32_t recordSeq;           /*!< Sequence number of the next record. */
+    uint32_t lastTimeMs;          /*!< Time of the newest record, 0 when the store is empty. */
+    uint32_t programCount;        /*!< Pages programmed since the mount. */
+    uint32_t eraseCount;          /*!< Sectors erased since the mount. */
+    p3t1085_flashlog_sector_t sectors[P3T1085_FLASHLOG_MAX_SECTORS];
+} p3t1085_flashlog_t;
+
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+/*! @brief       The interface function to mount a store.
+ *  @details     This function recovers the state left by the last append, whatever the point a
+ *               power loss cut it at. An erased region is an empty store, no format is needed.
+ *  @param[in]   pLog     the store.
+ *  @param[in]   pFlash   the flash region, kept by the store.
+ *  @constraints None
+ *  @reeentrant  No
+ *  @return      ::P3T1085_FlashLog_Mount() returns the status .
+ */
+int32_t P3T1085_FlashLog_Mount(p3t1085_flashlog_t *pLog, const p3t1085_flash_t *pFlash);
+
+/*! @brief       The interface function to append a record.
+ *  @details     This function programs one page, and erases the next sector first when the
+ *               current one is full. The record is durable once the function returns.
+ *  @param[in]   pLog     the store.
+ *  @param[in]   timeMs   the time of the record, it must not go back and may wrap.
+ *  @param[in]   pData    the payload.
+ *  @param[in]   length   the payload length, up to the page size less P3T1085_FLASHLOG_HEADER_SIZE.
+ *  @constraints None
+ *  @reeentrant  No
+ *  @return      ::P3T1085_FlashLog_Append() returns the status, a failed page is skipped by the next append.
+ */
+int32_t P3T1085_FlashLog_Append(p3t1085_flashlog_t *pLog, uint32_t timeMs, const uint8_t *pData, uint16_t length);
+
+/*! @brief       The interface function to read the records in order.
+ *  @details     Start with *pAddress at P3T1085_FLASHLOG_OLDEST, then continue with the record
+ *               address plus one. Torn pages are skipped.
+ *  @param[in]   pLog       the store.
+ *  @param[in,out] pAddress the address to start from, set to the address of the record found.
+ *  @param[out]  pRecord    the record.
+ *  @param[out]  pData      the payload, at least the page size less P3T1085_FLASHLOG_HEADER_SIZE, may be NULL.
+ *  @constraints None
+ *  @reeentrant  No
+ *  @return      ::P3T1085_FlashLog_Read() returns the status, SENSOR_ERROR_INVALID_PARAM past the newest record.
+ */
+int32_t P3T1085_FlashLog_Read(const p3t1085_flashlog_t *pLog,
+                              uint32_t *pAddress,
+                              p3t1085_flashlog_record_t *pRecord,
+                              uint8_t *pData);
+
+/*! @brief       The interface function to find the record holding a time.
+ *  @details     This function does a binary search over the sectors and scans one sector.
+ *  @param[in]   pLog       the store.
+ *  @param[in]   timeMs     the time.
+ *  @param[out]  pAddress   the address of the newest record at or before the time.
+ *  @constraints None
+ *  @reeentrant  No
+ *  @return      ::P3T1085_FlashLog_Find() returns the status, SENSOR_ERROR_INVALID_PARAM when the store
+ *               is empty or the time is before the oldest record.
+ */
+int32_t P3T1085_FlashLog_Find(const p3t1085_flashlog_t *pLog, uint32_t timeMs, uint32_t *pAddress);
+
+#endif /* P3T1085UK_FLASHLOG_H_ */
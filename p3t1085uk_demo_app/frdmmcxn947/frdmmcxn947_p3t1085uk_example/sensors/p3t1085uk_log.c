@@ -0,0 +1,464 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file p3t1085uk_log.c
+ * @brief The p3t1085uk_log.c file implements the P3T1085UK compressed sample log.
+ */
+
+//-----------------------------------------------------------------------
+// Standard C Includes
+//-----------------------------------------------------------------------
+#include <string.h>
+
+//-----------------------------------------------------------------------
+// ISSDK Includes
+//-----------------------------------------------------------------------
+#include "sensor_drv.h"
+#include "p3t1085uk_log.h"
+#include "sensor_no_heap.h"
+
+//-----------------------------------------------------------------------
+// Macros
+//-----------------------------------------------------------------------
+#define P3T1085_LOG_STREAM_BITS ((uint32_t)(P3T1085_LOG_BLOCK_SIZE - P3T1085_LOG_HEADER_SIZE) * 8U)
+#define P3T1085_LOG_CODE_MASK   ((1U << P3T1085_LOG_CODE_BITS) - 1U)
+#define P3T1085_LOG_K_SHIFT     (12U)
+
+/* Header field offsets. */
+#define P3T1085_LOG_TIME_OFFSET   (0U)
+#define P3T1085_LOG_PERIOD_OFFSET (4U)
+#define P3T1085_LOG_KEY_OFFSET    (6U)
+#define P3T1085_LOG_COUNT_OFFSET  (8U)
+
+#if (P3T1085_LOG_BLOCK_SIZE <= P3T1085_LOG_HEADER_SIZE + 3) || (P3T1085_LOG_BLOCK_SIZE > 8192)
+#error "P3T1085_LOG_BLOCK_SIZE must hold a code after the header and count readings in 16 bits"
+#endif
+
+//-----------------------------------------------------------------------
+// Functions
+//-----------------------------------------------------------------------
+static void P3T1085_Log_Put16(uint8_t *p, uint16_t value)
+{
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+}
+
+static void P3T1085_Log_Put32(uint8_t *p, uint32_t value)
+{
+    P3T1085_Log_Put16(p, (uint16_t)value);
+    P3T1085_Log_Put16(&p[2], (uint16_t)(value >> 16));
+}
+
+static uint16_t P3T1085_Log_Get16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | ((uint16_t)p[1] << 8));
+}
+
+static uint32_t P3T1085_Log_Get32(const uint8_t *p)
+{
+    return (uint32_t)P3T1085_Log_Get16(p) | ((uint32_t)P3T1085_Log_Get16(&p[2]) << 16);
+}
+
+/* OR a code of at most P3T1085_LOG_MAX_BITS bits into the stream, it spans at most 4 bytes. */
+static void P3T1085_Log_PutBits(uint8_t *pStream, uint32_t bitPos, uint32_t code, uint32_t bits)
+{
+    uint8_t *p = &pStream[bitPos >> 3];
+    uint32_t offset = bitPos & 7U;
+    uint32_t word = code << (32U - offset - bits);
+    uint32_t bytes = (offset + bits + 7U) >> 3;
+
+    for (uint32_t i = 0; i < bytes; i++)
+    {
+        p[i] |= (uint8_t)(word >> (24U - 8U * i));
+    }
+}
+
+static uint32_t P3T1085_Log_GetBits(const uint8_t *pStream, uint32_t bitPos, uint32_t bits)
+{
+    const uint8_t *p = &pStream[bitPos >> 3];
+    uint32_t offset = bitPos & 7U;
+    uint32_t bytes = (offset + bits + 7U) >> 3;
+    uint32_t word = 0U;
+
+    for (uint32_t i = 0; i < bytes; i++)
+    {
+        word |= (uint32_t)p[i] << (24U - 8U * i);
+    }
+
+    return (word << offset) >> (32U - bits);
+}
+
+/* Position in the ring of the block index from the oldest. */
+static uint32_t P3T1085_Log_Slot(const p3t1085_log_t *pLog, uint32_t index)
+{
+    index += pLog->first;
+
+    return (index >= pLog->blockCount) ? index - pLog->blockCount : index;
+}
+
+static uint8_t *P3T1085_Log_Block(const p3t1085_log_t *pLog, uint32_t index)
+{
+    return &pLog->pBlocks[P3T1085_Log_Slot(pLog, index) * P3T1085_LOG_BLOCK_SIZE];
+}
+
+static void P3T1085_Log_Merge(p3t1085_log_summary_t *pSummary, const p3t1085_log_summary_t *pOther)
+{
+    pSummary->sumQ4 += pOther->sumQ4;
+    pSummary->count += pOther->count;
+    pSummary->minQ4 = (pOther->minQ4 < pSummary->minQ4) ? pOther->minQ4 : pSummary->minQ4;
+    pSummary->maxQ4 = (pOther->maxQ4 > pSummary->maxQ4) ? pOther->maxQ4 : pSummary->maxQ4;
+}
+
+static void P3T1085_Log_Add(p3t1085_log_summary_t *pSummary, int16_t tempQ4)
+{
+    pSummary->sumQ4 += tempQ4;
+    pSummary->count++;
+    pSummary->minQ4 = (tempQ4 < pSummary->minQ4) ? tempQ4 : pSummary->minQ4;
+    pSummary->maxQ4 = (tempQ4 > pSummary->maxQ4) ? tempQ4 : pSummary->maxQ4;
+}
+
+/* Decoder of the readings of a block after its keyframe. */
+typedef struct
+{
+    const uint8_t *pStream;
+    uint32_t bitPos;
+    uint32_t k;
+    int16_t tempQ4;
+} p3t1085_log_cursor_t;
+
+/* Start a cursor on a block, returns the keyframe reading. */
+static int16_t P3T1085_Log_First(p3t1085_log_cursor_t *pCursor, const uint8_t *pBlock)
+{
+    uint16_t key = P3T1085_Log_Get16(&pBlock[P3T1085_LOG_KEY_OFFSET]);
+
+    pCursor->pStream = &pBlock[P3T1085_LOG_HEADER_SIZE];
+    pCursor->bitPos = 0U;
+    pCursor->k = key >> P3T1085_LOG_K_SHIFT;
+    /* Sign-extend the 12-bit codes. */
+    pCursor->tempQ4 = (int16_t)((int16_t)(key << 4) >> 4);
+
+    return pCursor->tempQ4;
+}
+
+static int16_t P3T1085_Log_Next(p3t1085_log_cursor_t *pCursor)
+{
+    uint32_t q;
+    uint32_t z;
+
+    for (q = 0U; (q < P3T1085_LOG_ESCAPE_Q) && (P3T1085_Log_GetBits(pCursor->pStream, pCursor->bitPos + q, 1U) != 0U);
+         q++)
+    {
+    }
+    if (q == P3T1085_LOG_ESCAPE_Q)
+    {
+        pCursor->tempQ4 = (int16_t)(
+            (int16_t)(P3T1085_Log_GetBits(pCursor->pStream, pCursor->bitPos + q, P3T1085_LOG_CODE_BITS) << 4) >> 4);
+        pCursor->bitPos += P3T1085_LOG_MAX_BITS;
+    }
+    else
+    {
+        z = (q << pCursor->k) |
+            ((pCursor->k != 0U) ? P3T1085_Log_GetBits(pCursor->pStream, pCursor->bitPos + q + 1U, pCursor->k) : 0U);
+        pCursor->bitPos += q + 1U + pCursor->k;
+        pCursor->tempQ4 =
+            (int16_t)(pCursor->tempQ4 + (int16_t)((z & 1U) ? -(int32_t)((z + 1U) >> 1) : (int32_t)(z >> 1)));
+    }
+
+    return pCursor->tempQ4;
+}
+
+/* Close the open block, if any, and start the next one with a keyframe. */
+static void P3T1085_Log_Open(p3t1085_log_t *pLog, int16_t tempQ4, uint32_t timeMs)
+{
+    p3t1085_log_summary_t *pSummary;
+    uint8_t *pBlock;
+    uint32_t coded = (pLog->count > 1U) ? (uint32_t)pLog->count - 1U : 0U;
+
+    /* Rice parameter of the next block: the smallest k with coded * 2^k >= sum of the values. */
+    if (coded != 0U)
+    {
+        pLog->k = 0U;
+        while ((pLog->k < P3T1085_LOG_MAX_K) && ((coded << pLog->k) < pLog->sumZ))
+        {
+            pLog->k++;
+        }
+    }
+
+    if ((pLog->used != 0U) && (pLog->sink != NULL))
+    {
+        pLog->sink(pLog->pSinkData, P3T1085_Log_Block(pLog, pLog->used - 1U),
+                   &pLog->pSummaries[P3T1085_Log_Slot(pLog, pLog->used - 1U)]);
+    }
+
+    if (pLog->used == pLog->blockCount)
+    {
+        pLog->first = (pLog->first + 1U == pLog->blockCount) ? 0U : pLog->first + 1U;
+        pLog->used--;
+    }
+    pBlock = P3T1085_Log_Block(pLog, pLog->used);
+    pSummary = &pLog->pSummaries[P3T1085_Log_Slot(pLog, pLog->used)];
+    pLog->used++;
+
+    pSummary->sumQ4 = tempQ4;
+    pSummary->count = 1U;
+    pSummary->minQ4 = tempQ4;
+    pSummary->maxQ4 = tempQ4;
+
+    memset(pBlock, 0, P3T1085_LOG_BLOCK_SIZE);
+    P3T1085_Log_Put32(&pBlock[P3T1085_LOG_TIME_OFFSET], timeMs);
+    P3T1085_Log_Put16(&pBlock[P3T1085_LOG_KEY_OFFSET],
+                      (uint16_t)(((uint16_t)tempQ4 & P3T1085_LOG_CODE_MASK) | ((uint16_t)pLog->k << P3T1085_LOG_K_SHIFT)));
+    P3T1085_Log_Put16(&pBlock[P3T1085_LOG_COUNT_OFFSET], 1U);
+
+    pLog->bitPos = 0U;
+    pLog->slotMs = timeMs;
+    pLog->sumZ = 0U;
+    pLog->count = 1U;
+    pLog->periodMs = 0U;
+    pLog->lastQ4 = tempQ4;
+}
+
+int32_t P3T1085_Log_Init(p3t1085_log_t *pLog, uint8_t *pBuffer, uint32_t bufferSize)
+{
+    /* The summaries come first, aligned, then the blocks. */
+    uint32_t align = (uint32_t)(-(uintptr_t)pBuffer & (sizeof(int32_t) - 1U));
+
+    /*! Check the input parameters. */
+    if ((pLog == NULL) || (pBuffer == NULL) ||
+        (bufferSize < align + 2U * (P3T1085_LOG_BLOCK_SIZE + sizeof(p3t1085_log_summary_t))))
+    {
+        return SENSOR_ERROR_INVALID_PARAM;
+    }
+
+    memset(pLog, 0, sizeof(*pLog));
+    pLog->blockCount = (bufferSize - align) / (P3T1085_LOG_BLOCK_SIZE + sizeof(p3t1085_log_summary_t));
+    pLog->pSummaries = (p3t1085_log_summary_t *)(void *)&pBuffer[align];
+    pLog->pBlocks = (uint8_t *)&pLog->pSummaries[pLog->blockCount];
+
+    return SENSOR_ERROR_NONE;
+}
+
+void P3T1085_Log_Append(p3t1085_log_t *pLog, int16_t tempQ4, uint32_t timeMs)
+{
+    uint8_t *pBlock;
+    uint32_t elapsed = timeMs - pLog->slotMs;
+    uint32_t z;
+    uint32_t q;
+    uint32_t code;
+    uint32_t bits;
+    int32_t delta = (int32_t)tempQ4 - pLog->lastQ4;
+
+    pLog->sampleCount++;
+    if (pLog->used == 0U)
+    {
+        P3T1085_Log_Open(pLog, tempQ4, timeMs);
+        return;
+    }
+
+    pBlock = P3T1085_Log_Block(pLog, pLog->used - 1U);
+    if (pLog->count == 1U)
+    {
+        /* The second reading sets the period of the block. */
+        if ((elapsed == 0U) || (elapsed > UINT16_MAX))
+        {
+            P3T1085_Log_Open(pLog, tempQ4, timeMs);
+            return;
+        }
+        pLog->periodMs = (uint16_t)elapsed;
+        P3T1085_Log_Put16(&pBlock[P3T1085_LOG_PERIOD_OFFSET], pLog->periodMs);
+    }
+    else
+    {
+        /* A reading more than half a period off its slot starts a new block. */
+        elapsed -= pLog->periodMs;
+        if ((elapsed > pLog->periodMs / 2U) && (-elapsed > pLog->periodMs / 2U))
+        {
+            P3T1085_Log_Open(pLog, tempQ4, timeMs);
+            return;
+        }
+    }
+
+    z = (delta < 0) ? (((uint32_t)-delta << 1) - 1U) : ((uint32_t)delta << 1);
+    q = z >> pLog->k;
+    if (q < P3T1085_LOG_ESCAPE_Q)
+    {
+        code = (((1U << q) - 1U) << (pLog->k + 1U)) | (z & ((1U << pLog->k) - 1U));
+        bits = q + 1U + pLog->k;
+    }
+    else
+    {
+        code = (((1U << P3T1085_LOG_ESCAPE_Q) - 1U) << P3T1085_LOG_CODE_BITS) |
+               ((uint32_t)(uint16_t)tempQ4 & P3T1085_LOG_CODE_MASK);
+        bits = P3T1085_LOG_MAX_BITS;
+    }
+
+    if (pLog->bitPos + bits > P3T1085_LOG_STREAM_BITS)
+    {
+        P3T1085_Log_Open(pLog, tempQ4, timeMs);
+        return;
+    }
+
+    P3T1085_Log_PutBits(&pBlock[P3T1085_LOG_HEADER_SIZE], pLog->bitPos, code, bits);
+    pLog->bitPos += bits;
+    pLog->count++;
+    P3T1085_Log_Put16(&pBlock[P3T1085_LOG_COUNT_OFFSET], pLog->count);
+    pLog->slotMs += pLog->periodMs;
+    pLog->sumZ += z;
+    pLog->lastQ4 = tempQ4;
+    P3T1085_Log_Add(&pLog->pSummaries[P3T1085_Log_Slot(pLog, pLog->used - 1U)], tempQ4);
+}
+
+const uint8_t *P3T1085_Log_GetBlock(const p3t1085_log_t *pLog, uint32_t index)
+{
+    return (index < pLog->used) ? P3T1085_Log_Block(pLog, index) : NULL;
+}
+
+const p3t1085_log_summary_t *P3T1085_Log_GetSummary(const p3t1085_log_t *pLog, uint32_t index)
+{
+    return (index < pLog->used) ? &pLog->pSummaries[P3T1085_Log_Slot(pLog, index)] : NULL;
+}
+
+void P3T1085_Log_SetSink(p3t1085_log_t *pLog, p3t1085_log_sink_t sink, void *pUserData)
+{
+    pLog->sink = sink;
+    pLog->pSinkData = pUserData;
+}
+
+int32_t P3T1085_Log_FindBlock(const p3t1085_log_t *pLog, uint32_t timeMs, uint32_t *pIndex)
+{
+    uint32_t baseMs;
+    uint32_t lo = 0U;
+    uint32_t hi;
+    uint32_t mid;
+
+    if ((pLog->used == 0U) || (pIndex == NULL))
+    {
+        return SENSOR_ERROR_INVALID_PARAM;
+    }
+
+    /* Times are compared as offsets from the oldest keyframe, so they may wrap once. */
+    baseMs = P3T1085_Log_Get32(&P3T1085_Log_Block(pLog, 0U)[P3T1085_LOG_TIME_OFFSET]);
+    if ((int32_t)(timeMs - baseMs) < 0)
+    {
+        return SENSOR_ERROR_INVALID_PARAM;
+    }
+
+    hi = pLog->used - 1U;
+    while (lo < hi)
+    {
+        mid = (lo + hi + 1U) / 2U;
+        if ((P3T1085_Log_Get32(&P3T1085_Log_Block(pLog, mid)[P3T1085_LOG_TIME_OFFSET]) - baseMs) <= (timeMs - baseMs))
+        {
+            lo = mid;
+        }
+        else
+        {
+            hi = mid - 1U;
+        }
+    }
+    *pIndex = lo;
+
+    return SENSOR_ERROR_NONE;
+}
+
+uint32_t P3T1085_Log_DecodeBlock(
+    const uint8_t *pBlock, int16_t *pTempQ4, uint32_t maxCount, uint32_t *pTimeMs, uint16_t *pPeriodMs)
+{
+    p3t1085_log_cursor_t cursor;
+    uint32_t count = P3T1085_Log_Get16(&pBlock[P3T1085_LOG_COUNT_OFFSET]);
+
+    if (pTimeMs != NULL)
+    {
+        *pTimeMs = P3T1085_Log_Get32(&pBlock[P3T1085_LOG_TIME_OFFSET]);
+    }
+    if (pPeriodMs != NULL)
+    {
+        *pPeriodMs = P3T1085_Log_Get16(&pBlock[P3T1085_LOG_PERIOD_OFFSET]);
+    }
+
+    count = (count < maxCount) ? count : maxCount;
+    if (count == 0U)
+    {
+        return 0U;
+    }
+
+    pTempQ4[0] = P3T1085_Log_First(&cursor, pBlock);
+    for (uint32_t i = 1U; i < count; i++)
+    {
+        pTempQ4[i] = P3T1085_Log_Next(&cursor);
+    }
+
+    return count;
+}
+
+/* Add the readings of a block whose offset from baseMs is within the range. */
+static void P3T1085_Log_QueryBlock(const p3t1085_log_t *pLog,
+                                   uint32_t index,
+                                   uint32_t baseMs,
+                                   uint32_t fromOffset,
+                                   uint32_t toOffset,
+                                   p3t1085_log_summary_t *pResult)
+{
+    const uint8_t *pBlock = P3T1085_Log_Block(pLog, index);
+    p3t1085_log_cursor_t cursor;
+    uint32_t count = P3T1085_Log_Get16(&pBlock[P3T1085_LOG_COUNT_OFFSET]);
+    uint32_t periodMs = P3T1085_Log_Get16(&pBlock[P3T1085_LOG_PERIOD_OFFSET]);
+    uint32_t offset = P3T1085_Log_Get32(&pBlock[P3T1085_LOG_TIME_OFFSET]) - baseMs;
+    int16_t tempQ4 = P3T1085_Log_First(&cursor, pBlock);
+
+    for (uint32_t i = 0U; (i < count) && (offset <= toOffset); i++, offset += periodMs)
+    {
+        if (i != 0U)
+        {
+            tempQ4 = P3T1085_Log_Next(&cursor);
+        }
+        if (offset >= fromOffset)
+        {
+            P3T1085_Log_Add(pResult, tempQ4);
+        }
+    }
+}
+
+int32_t P3T1085_Log_Query(const p3t1085_log_t *pLog, uint32_t fromMs, uint32_t toMs, p3t1085_log_summary_t *pResult)
+{
+    uint32_t baseMs;
+    uint32_t first;
+    uint32_t last;
+
+    if ((pLog == NULL) || (pResult == NULL) || (pLog->used == 0U))
+    {
+        return SENSOR_ERROR_INVALID_PARAM;
+    }
+
+    pResult->sumQ4 = 0;
+    pResult->count = 0U;
+    pResult->minQ4 = INT16_MAX;
+    pResult->maxQ4 = INT16_MIN;
+
+    /*! Times are compared as offsets from the oldest keyframe, so they may wrap once. */
+    baseMs = P3T1085_Log_Get32(&P3T1085_Log_Block(pLog, 0U)[P3T1085_LOG_TIME_OFFSET]);
+    fromMs = ((int32_t)(fromMs - baseMs) < 0) ? baseMs : fromMs;
+    if (((int32_t)(toMs - baseMs) < 0) || ((toMs - baseMs) < (fromMs - baseMs)))
+    {
+        return SENSOR_ERROR_NONE;
+    }
+    (void)P3T1085_Log_FindBlock(pLog, fromMs, &first);
+    (void)P3T1085_Log_FindBlock(pLog, toMs, &last);
+
+    /*! The blocks between the two ends are inside the range. */
+    P3T1085_Log_QueryBlock(pLog, first, baseMs, fromMs - baseMs, toMs - baseMs, pResult);
+    for (uint32_t i = first + 1U; i < last; i++)
+    {
+        P3T1085_Log_Merge(pResult, &pLog->pSummaries[P3T1085_Log_Slot(pLog, i)]);
+    }
+    if (last != first)
+    {
+        P3T1085_Log_QueryBlock(pLog, last, baseMs, fromMs - baseMs, toMs - baseMs, pResult);
+    }
+
+    return SENSOR_ERROR_NONE;
+}
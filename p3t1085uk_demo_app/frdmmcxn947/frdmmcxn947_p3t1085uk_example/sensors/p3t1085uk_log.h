@@ -0,0 +1,196 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file p3t1085uk_log.h
+ * @brief The p3t1085uk_log.h file describes the P3T1085UK compressed sample log.
+
+    The log keeps a long history of one sensor in a ring of fixed-size blocks. Each block starts
+    with a keyframe, the first 12-bit temperature code and its time, so any block is decoded on
+    its own and a time is found with a binary search over the block headers. The following
+    readings are stored as the difference to the previous one, zigzag mapped to an unsigned
+    value and Rice coded with the parameter fitted to the previous block. A difference too large
+    for the code escapes to the raw 12-bit code, so no reading takes more than
+    P3T1085_LOG_MAX_BITS bits and one bounded write, whatever the trace.
+
+    Block layout, multi-byte fields little-endian, the bit stream MSB first:
+        0  timeMs     uint32  time of the keyframe
+        4  periodMs   uint16  time between the readings of the block, 0 with the keyframe only
+        6  key        uint16  keyframe code in bits 0-11, Rice parameter in bits 12-15
+        8  count      uint16  readings including the keyframe
+        10 bit stream of count - 1 codes: q ones, a zero and k low bits of the zigzag value
+           for q < P3T1085_LOG_ESCAPE_Q, or P3T1085_LOG_ESCAPE_Q ones and the 12-bit code.
+    A block is closed and the next keyframe written when the stream is full, or when a reading
+    comes more than half a period away from its slot, so the times rebuilt from the period are
+    never off by more than that. tools/p3t1085_log_decode.py decodes the blocks on the host.
+
+    Next to each block the log keeps its summary, the minimum, maximum, sum and count of its
+    readings, updated on every append. A range query then reads the summaries of the blocks
+    fully inside the range and decodes only the two blocks at its ends. A log holds one sensor,
+    a system with several sensors keeps one log, and so one summary index, per sensor.
+*/
+
+#ifndef P3T1085UK_LOG_H_
+#define P3T1085UK_LOG_H_
+
+/* Standard C Includes */
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief Size of a block in bytes. */
+#ifndef P3T1085_LOG_BLOCK_SIZE
+#define P3T1085_LOG_BLOCK_SIZE 64
+#endif
+
+/*! @brief Size of the block header in bytes. */
+#define P3T1085_LOG_HEADER_SIZE (10)
+
+/*! @brief Unary length of the escape to a raw code, and the worst-case bits of a reading. */
+#define P3T1085_LOG_ESCAPE_Q  (8)
+#define P3T1085_LOG_CODE_BITS (12)
+#define P3T1085_LOG_MAX_BITS  (P3T1085_LOG_ESCAPE_Q + P3T1085_LOG_CODE_BITS)
+
+/*! @brief Largest Rice parameter, a zigzag value of 12-bit codes takes at most 13 bits. */
+#define P3T1085_LOG_MAX_K (11)
+
+/*!
+ * @brief This defines the summary of a block, or the result of a range query.
+ */
+typedef struct
+{
+    int32_t sumQ4;                /*!< Sum of the readings, the mean is sumQ4 / count. */
+    uint32_t count;               /*!< Readings. */
+    int16_t minQ4;                /*!< Lowest reading, INT16_MAX without reading. */
+    int16_t maxQ4;                /*!< Highest reading, INT16_MIN without reading. */
+} p3t1085_log_summary_t;
+
+/*!
+ * @brief This defines the function given each block and its summary once it is closed, for example to keep them in flash.
+ */
+typedef void (*p3t1085_log_sink_t)(void *pUserData, const uint8_t *pBlock, const p3t1085_log_summary_t *pSummary);
+
+/*!
+ * @brief This defines the log state, all temperatures are in 1/16 celsius units.
+ */
+typedef struct
+{
+    uint8_t *pBlocks;             /*!< Ring of blocks. */
+    p3t1085_log_summary_t *pSummaries; /*!< Summary of each block of the ring. */
+    uint32_t blockCount;          /*!< Blocks in the ring. */
+    uint32_t first;               /*!< Oldest block. */
+    uint32_t used;                /*!< Blocks holding readings, the last one is open. */
+    uint32_t bitPos;              /*!< Next bit of the open block stream. */
+    uint32_t slotMs;              /*!< Time of the slot of the next reading. */
+    uint32_t sumZ;                /*!< Zigzag values of the open block, fits the next parameter. */
+    uint32_t sampleCount;         /*!< Readings appended. */
+    uint16_t count;               /*!< Readings of the open block. */
+    uint16_t periodMs;            /*!< Period of the open block. */
+    uint8_t k;                    /*!< Rice parameter of the open block. */
+    int16_t lastQ4;               /*!< Last reading. */
+    p3t1085_log_sink_t sink;      /*!< Called with each closed block, may be NULL. */
+    void *pSinkData;
+} p3t1085_log_t;
+
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+/*! @brief       The interface function to initialize an empty log.
+ *  @param[in]   pLog         the log.
+ *  @param[in]   pBuffer      the memory of the ring and its summaries, owned by the log.
+ *  @param[in]   bufferSize   the size of the memory, at least two blocks and their summaries, a partial block is unused.
+ *  @constraints None
+ *  @reeentrant  No
+ *  @return      ::P3T1085_Log_Init() returns the status .
+ */
+int32_t P3T1085_Log_Init(p3t1085_log_t *pLog, uint8_t *pBuffer, uint32_t bufferSize);
+
+/*! @brief       The interface function to append a reading.
+ *  @details     A reading costs at most P3T1085_LOG_MAX_BITS bits and a bounded number of
+ *               operations, plus clearing a block when one is started. Once the ring is full
+ *               the oldest block is overwritten.
+ *  @param[in]   pLog     the log.
+ *  @param[in]   tempQ4   the temperature, within the 12-bit range of the sensor.
+ *  @param[in]   timeMs   the time of the reading, it must not go back and may wrap.
+ *  @constraints None
+ *  @reeentrant  No
+ *  @return      void.
+ */
+void P3T1085_Log_Append(p3t1085_log_t *pLog, int16_t tempQ4, uint32_t timeMs);
+
+/*! @brief       The interface function to set the function given the closed blocks.
+ *  @details     The sink is called from P3T1085_Log_Append() when a block is closed, before the
+ *               ring can overwrite it. The open block is not passed until it is closed.
+ *  @param[in]   pLog       the log.
+ *  @param[in]   sink       the function, NULL to stop.
+ *  @param[in]   pUserData  the argument of the function.
+ *  @constraints None
+ *  @reeentrant  No
+ *  @return      void.
+ */
+void P3T1085_Log_SetSink(p3t1085_log_t *pLog, p3t1085_log_sink_t sink, void *pUserData);
+
+/*! @brief       The interface function to get a block.
+ *  @param[in]   pLog     the log.
+ *  @param[in]   index    the block, 0 is the oldest and pLog->used - 1 the open one.
+ *  @constraints None
+ *  @reeentrant  No
+ *  @return      ::P3T1085_Log_GetBlock() returns the block, NULL beyond the used blocks.
+ */
+const uint8_t *P3T1085_Log_GetBlock(const p3t1085_log_t *pLog, uint32_t index);
+
+/*! @brief       The interface function to find the block holding a time.
+ *  @details     This function does a binary search over the block headers.
+ *  @param[in]   pLog     the log.
+ *  @param[in]   timeMs   the time.
+ *  @param[out]  pIndex   the newest block starting at or before the time.
+ *  @constraints None
+ *  @reeentrant  No
+ *  @return      ::P3T1085_Log_FindBlock() returns the status, SENSOR_ERROR_INVALID_PARAM when the
+ *               log is empty or the time is before the oldest block.
+ */
+int32_t P3T1085_Log_FindBlock(const p3t1085_log_t *pLog, uint32_t timeMs, uint32_t *pIndex);
+
+/*! @brief       The interface function to get the summary of a block.
+ *  @param[in]   pLog     the log.
+ *  @param[in]   index    the block, 0 is the oldest and pLog->used - 1 the open one.
+ *  @constraints None
+ *  @reeentrant  No
+ *  @return      ::P3T1085_Log_GetSummary() returns the summary, NULL beyond the used blocks.
+ */
+const p3t1085_log_summary_t *P3T1085_Log_GetSummary(const p3t1085_log_t *pLog, uint32_t index);
+
+/*! @brief       The interface function to summarize the readings of a time range.
+ *  @details     The blocks inside the range are taken from their summaries, only the blocks
+ *               holding the two ends are decoded. The time of a reading is the one rebuilt
+ *               from its block period, within half a period of the time it was appended at.
+ *  @param[in]   pLog     the log.
+ *  @param[in]   fromMs   the start of the range, included, clipped to the oldest block.
+ *  @param[in]   toMs     the end of the range, included.
+ *  @param[out]  pResult  the minimum, maximum, sum and count of the readings in the range,
+ *                        a count of 0 when there is none.
+ *  @constraints None
+ *  @reeentrant  No
+ *  @return      ::P3T1085_Log_Query() returns the status, SENSOR_ERROR_INVALID_PARAM when the log is empty.
+ */
+int32_t P3T1085_Log_Query(const p3t1085_log_t *pLog, uint32_t fromMs, uint32_t toMs, p3t1085_log_summary_t *pResult);
+
+/*! @brief       The interface function to decode a block.
+ *  @param[in]   pBlock     the block.
+ *  @param[out]  pTempQ4    the temperatures, in order, may be NULL with a maxCount of 0 to read the header.
+ *  @param[in]   maxCount   the size of pTempQ4.
+ *  @param[out]  pTimeMs    the time of the first reading, may be NULL.
+ *  @param[out]  pPeriodMs  the time between the readings, may be NULL.
+ *  @constraints None
+ *  @reeentrant  Yes
+ *  @return      ::P3T1085_Log_DecodeBlock() returns the number of readings decoded.
+ */
+uint32_t P3T1085_Log_DecodeBlock(
+    const uint8_t *pBlock, int16_t *pTempQ4, uint32_t maxCount, uint32_t *pTimeMs, uint16_t *pPeriodMs);
+
+#endif /* P3T1085UK_LOG_H_ */
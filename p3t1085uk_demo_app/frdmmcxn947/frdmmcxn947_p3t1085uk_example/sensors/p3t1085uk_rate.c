@@ -0,0 +1,174 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file p3t1085uk_rate.c
+ * @brief The p3t1085uk_rate.c file implements the P3T1085UK adaptive conversion rate policy.
+ */
+
+//-----------------------------------------------------------------------
+// ISSDK Includes
+//-----------------------------------------------------------------------
+#include "fsl_common.h"
+#include "p3t1085uk.h"
+#include "p3t1085uk_alarm.h"
+#include "p3t1085uk_rate.h"
+#include "sensor_no_heap.h"
+
+//-----------------------------------------------------------------------
+// Functions
+//-----------------------------------------------------------------------
+/* Rate asked for by a reading: each criterion counts the steps below the maximum rate it
+ * allows, the busier one wins. */
+static enum ECRate P3T1085_Rate_Target(const p3t1085_rate_t *pRate, int16_t tempQ4, int32_t slopeMilliCPerS)
+{
+    const p3t1085_rate_policy_t *pPolicy = &pRate->policy;
+    int32_t margin = MIN((int32_t)pRate->tHighQ4 - tempQ4, (int32_t)tempQ4 - pRate->tLowQ4);
+    int32_t slope = (slopeMilliCPerS < 0) ? -slopeMilliCPerS : slopeMilliCPerS;
+    int32_t limit;
+    int32_t rate;
+    uint8_t nearSteps = 0U;
+    uint8_t slopeSteps = 0U;
+    uint8_t maxSteps = (uint8_t)(pPolicy->maxRate - pPolicy->minRate);
+
+    for (limit = pPolicy->nearQ4; (margin > limit) && (nearSteps < maxSteps); limit *= 2)
+    {
+        nearSteps++;
+    }
+    for (limit = pPolicy->fastMilliCPerS; (slope < limit) && (slopeSteps < maxSteps); limit /= 4)
+    {
+        slopeSteps++;
+    }
+
+    rate = (int32_t)pPolicy->maxRate - MIN(nearSteps, slopeSteps);
+
+    return (enum ECRate)rate;
+}
+
+/* Overwrite CONFIG with the cached value and the new rate, no read needed. */
+static int32_t P3T1085_Rate_Apply(p3t1085_rate_t *pRate, enum ECRate rate)
+{
+    int32_t status;
+    uint16_t config = (uint16_t)((pRate->config & ~P3T1085UK_CONFIG_CR_MASK) |
+                                 (((uint16_t)rate << P3T1085UK_CONFIG_CR_SHIFT) & P3T1085UK_CONFIG_CR_MASK));
+    const registerwritelist16_t writeList[] = {{.writeTo = P3T1085UK_CONFIG, .value = config, .mask = 0},
+                                               __END_WRITE_DATA__};
+
+    status = P3T1085_I2C_WriteData16(pRate->pSensorHandle, writeList);
+    if (SENSOR_ERROR_NONE != status)
+    {
+        return status;
+    }
+
+    pRate->config = config;
+    pRate->rate = rate;
+    pRate->writeCount++;
+
+    return SENSOR_ERROR_NONE;
+}
+
+int32_t P3T1085_Rate_Init(p3t1085_rate_t *pRate,
+                          p3t1085_i2c_sensorhandle_t *pSensorHandle,
+                          const p3t1085_config_t *pConfig,
+                          const p3t1085_rate_policy_t *pPolicy)
+{
+    /*! Check the input parameters. */
+    if ((pRate == NULL) || (pSensorHandle == NULL) || (pConfig == NULL) || (pPolicy == NULL))
+    {
+        return SENSOR_ERROR_INVALID_PARAM;
+    }
+
+    if ((pPolicy->minRate > pPolicy->maxRate) || (pPolicy->maxRate > P3T1085UK_CR_16HZ) || (pPolicy->nearQ4 <= 0) ||
+        (pPolicy->fastMilliCPerS <= 0))
+    {
+        return SENSOR_ERROR_INVALID_PARAM;
+    }
+
+    pRate->pSensorHandle = pSensorHandle;
+    pRate->policy = *pPolicy;
+    pRate->enabled = true;
+    pRate->lowerPending = false;
+    pRate->config = (uint16_t)(pConfig->config & ~P3T1085UK_CONFIG_RO_MASK);
+    pRate->tLowQ4 = P3T1085UK_TEMP_REG_TO_Q4(pConfig->tlow);
+    pRate->tHighQ4 = P3T1085UK_TEMP_REG_TO_Q4(pConfig->thigh);
+    pRate->rate = (enum ECRate)((pConfig->config & P3T1085UK_CONFIG_CR_MASK) >> P3T1085UK_CONFIG_CR_SHIFT);
+    pRate->writeCount = 0U;
+
+    return SENSOR_ERROR_NONE;
+}
+
+void P3T1085_Rate_Enable(p3t1085_rate_t *pRate, bool enable)
+{
+    pRate->enabled = enable;
+    pRate->lowerPending = false;
+}
+
+void P3T1085_Rate_SetThresholds(p3t1085_rate_t *pRate, int16_t tLowQ4, int16_t tHighQ4)
+{
+    pRate->tLowQ4 = tLowQ4;
+    pRate->tHighQ4 = tHighQ4;
+}
+
+int32_t P3T1085_Rate_Resync(p3t1085_rate_t *pRate)
+{
+    int32_t status;
+    uint8_t reg[P3T1085UK_REG_SIZE_BYTES];
+    uint16_t config;
+    const registerreadlist_t readList[] = {{.readFrom = P3T1085UK_CONFIG, .numBytes = P3T1085UK_REG_SIZE_BYTES},
+                                           __END_READ_DATA__};
+
+    status = P3T1085_I2C_ReadData(pRate->pSensorHandle, readList, reg);
+    if (SENSOR_ERROR_NONE != status)
+    {
+        return status;
+    }
+
+    config = (uint16_t)((uint16_t)reg[0] << 8) | (uint16_t)reg[1];
+    pRate->config = (uint16_t)(config & ~P3T1085UK_CONFIG_RO_MASK);
+    pRate->rate = (enum ECRate)((config & P3T1085UK_CONFIG_CR_MASK) >> P3T1085UK_CONFIG_CR_SHIFT);
+    pRate->lowerPending = false;
+
+    return SENSOR_ERROR_NONE;
+}
+
+int32_t P3T1085_Rate_Update(p3t1085_rate_t *pRate, int16_t tempQ4, int32_t slopeMilliCPerS, uint32_t timeMs)
+{
+    enum ECRate target;
+
+    if (!pRate->enabled)
+    {
+        return SENSOR_ERROR_NONE;
+    }
+
+    target = P3T1085_Rate_Target(pRate, tempQ4, slopeMilliCPerS);
+    if (target > pRate->rate)
+    {
+        /* Speed up at once, the activity may already be close to a threshold. */
+        pRate->lowerPending = false;
+        return P3T1085_Rate_Apply(pRate, target);
+    }
+
+    if (target == pRate->rate)
+    {
+        pRate->lowerPending = false;
+        return SENSOR_ERROR_NONE;
+    }
+
+    /* Slow down one step per hold time. */
+    if (!pRate->lowerPending)
+    {
+        pRate->lowerPending = true;
+        pRate->lowerSinceMs = timeMs;
+        return SENSOR_ERROR_NONE;
+    }
+    if ((timeMs - pRate->lowerSinceMs) < pRate->policy.holdMs)
+    {
+        return SENSOR_ERROR_NONE;
+    }
+
+    pRate->lowerSinceMs = timeMs;
+    return P3T1085_Rate_Apply(pRate, (enum ECRate)(pRate->rate - 1));
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file p3t1085uk_rate.h
+ * @brief The p3t1085uk_rate.h file describes the P3T1085UK adaptive conversion rate policy.
+
+    The policy picks the conversion rate from the thermal activity seen in the sample stream:
+    the closer the temperature is to TLOW or THIGH, and the faster it changes, the higher the
+    rate. A higher rate is applied on the reading which asks for it, a lower one only after it
+    was asked for during the whole hold time, and one step at a time, so a noisy stream does not
+    toggle the rate. The CONFIG value is cached, a rate change is a single overwrite of CONFIG
+    without the read of P3T1085_I2C_SetConversionRate(), and readings which keep the rate cost
+    no bus access at all.
+*/
+
+#ifndef P3T1085UK_RATE_H_
+#define P3T1085UK_RATE_H_
+
+/* Standard C Includes */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* ISSDK Includes */
+#include "p3t1085uk_drv.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*!
+ * @brief This defines the policy, all temperatures are in 1/16 celsius units.
+ */
+typedef struct
+{
+    int16_t nearQ4;               /*!< Margin to TLOW or THIGH asking for the maximum rate, each
+                                       doubling of the margin asks for one step less. */
+    int32_t fastMilliCPerS;       /*!< Slope asking for the maximum rate, each division by four
+                                       asks for one step less. */
+    uint32_t holdMs;              /*!< Time a lower rate must be asked for before stepping down. */
+    enum ECRate minRate;          /*!< Rate of a stable temperature far from the thresholds. */
+    enum ECRate maxRate;          /*!< Rate of the highest activity. */
+} p3t1085_rate_policy_t;
+
+/*!
+ * @brief This defines the policy state of one sensor.
+ */
+typedef struct
+{
+    p3t1085_i2c_sensorhandle_t *pSensorHandle;
+    p3t1085_rate_policy_t policy;
+    bool enabled;                 /*!< The policy changes the rate. */
+    bool lowerPending;            /*!< A lower rate is asked for since lowerSinceMs. */
+    uint16_t config;              /*!< Cached CONFIG value. */
+    int16_t tLowQ4;               /*!< Cached TLOW. */
+    int16_t tHighQ4;              /*!< Cached THIGH. */
+    enum ECRate rate;             /*!< Current rate. */
+    uint32_t lowerSinceMs;
+    uint32_t writeCount;          /*!< CONFIG writes done by the policy. */
+} p3t1085_rate_t;
+
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+/*! @brief       The interface function to initialize the rate policy of a sensor.
+ *  @details     This function caches CONFIG, TLOW and THIGH of the configuration applied with
+ *               P3T1085_I2C_Configure(), the policy starts enabled at the configured rate.
+ *  @param[in]   pRate          the rate policy state.
+ *  @param[in]   pSensorHandle  handle to the sensor.
+ *  @param[in]   pConfig        the sensor configuration.
+ *  @param[in]   pPolicy        the policy, copied.
+ *  @constraints None
+ *  @reeentrant  No
+ *  @return      ::P3T1085_Rate_Init() returns the status .
+ */
+int32_t P3T1085_Rate_Init(p3t1085_rate_t *pRate,
+                          p3t1085_i2c_sensorhandle_t *pSensorHandle,
+                          const p3t1085_config_t *pConfig,
+                          const p3t1085_rate_policy_t *pPolicy);
+
+/*! @brief       The interface function to enable or disable the rate changes.
+ *  @details     A disabled policy leaves the rate to the application.
+ *  @param[in]   pRate    the rate policy state.
+ *  @param[in]   enable   true to let the policy change the rate.
+ *  @constraints None
+ *  @reeentrant  No
+ *  @return      void.
+ */
+void P3T1085_Rate_Enable(p3t1085_rate_t *pRate, bool enable);
+
+/*! @brief       The interface functions to keep the cached registers in line with the sensor.
+ *  @details     Call P3T1085_Rate_SetThresholds() whenever TLOW or THIGH is changed and
+ *               P3T1085_Rate_Resync() whenever another CONFIG field is changed, it reads CONFIG once.
+ *  @constraints None
+ *  @reeentrant  No
+ *  @return      ::P3T1085_Rate_Resync() returns the status.
+ */
+void P3T1085_Rate_SetThresholds(p3t1085_rate_t *pRate, int16_t tLowQ4, int16_t tHighQ4);
+int32_t P3T1085_Rate_Resync(p3t1085_rate_t *pRate);
+
+/*! @brief       The interface function to run the policy on a reading.
+ *  @details     This function writes CONFIG only when the rate changes.
+ *  @param[in]   pRate            the rate policy state.
+ *  @param[in]   tempQ4           the temperature.
+ *  @param[in]   slopeMilliCPerS  the temperature slope, for example from P3T1085_Trend_Get(), 0 if unknown.
+ *  @param[in]   timeMs           the time of the reading, it must not go back and may wrap.
+ *  @constraints Application has to ensure that previous instances of the sensor APIs have exited before invocation.
+ *  @reeentrant  No
+ *  @return      ::P3T1085_Rate_Update() returns the status of the CONFIG write, the rate is kept when it fails.
+ */
+int32_t P3T1085_Rate_Update(p3t1085_rate_t *pRate, int16_t tempQ4, int32_t slopeMilliCPerS, uint32_t timeMs);
+
+#endif /* P3T1085UK_RATE_H_ */
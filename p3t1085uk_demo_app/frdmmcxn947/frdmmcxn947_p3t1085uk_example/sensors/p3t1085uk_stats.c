@@ -0,0 +1,226 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file p3t1085uk_stats.c
+ * @brief The p3t1085uk_stats.c file implements the running statistics of a P3T1085UK sensor.
+ */
+
+//-----------------------------------------------------------------------
+// ISSDK Includes
+//-----------------------------------------------------------------------
+#include "fsl_common.h"
+#include "p3t1085uk_stats.h"
+#include "sensor_no_heap.h"
+
+//-----------------------------------------------------------------------
+// Global Variables
+//-----------------------------------------------------------------------
+static const uint32_t cStatsDefaultWindowMs[P3T1085_STATS_WINDOW_COUNT] = {
+    P3T1085_STATS_1S_MS, P3T1085_STATS_1MIN_MS, P3T1085_STATS_1H_MS};
+
+static p3t1085_stats_t *gStatsRegistry[P3T1085_STATS_MAX_SENSORS];
+
+//-----------------------------------------------------------------------
+// Functions
+//-----------------------------------------------------------------------
+/* Derive the statistics of a window from its sums. The deviations from the first sample fit in
+ * 13 bits, so the products below stay exact up to about 40 million samples per window. */
+static void P3T1085_Stats_Finish(const p3t1085_stats_sums_t *pSums, uint32_t startMs, p3t1085_stats_result_t *pResult)
+{
+    int64_t n = (int64_t)pSums->count;
+    int64_t q;
+    int64_t r;
+    uint64_t m2;
+
+    pResult->startMs = startMs;
+    pResult->count = pSums->count;
+    if (0 == n)
+    {
+        pResult->minQ4 = 0;
+        pResult->maxQ4 = 0;
+        pResult->meanQ4 = 0;
+        pResult->varianceQ8 = 0U;
+        return;
+    }
+
+    /* sum = q * n + r, with r of the sign of sum. */
+    q = pSums->sum / n;
+    r = pSums->sum % n;
+
+    pResult->minQ4 = pSums->minQ4;
+    pResult->maxQ4 = pSums->maxQ4;
+    pResult->meanQ4 = (int16_t)(pSums->refQ4 + q + ((2 * r >= n) ? 1 : ((2 * r <= -n) ? -1 : 0)));
+
+    /* M2 = sumSq - sum^2 / n, with sum^2 / n = q * sum + r * sum / n and both terms non negative. */
+    m2 = pSums->sumSq - (uint64_t)(q * pSums->sum) - (uint64_t)((r * pSums->sum) / n);
+    pResult->varianceQ8 = (uint32_t)((m2 + (uint64_t)n / 2U) / (uint64_t)n);
+}
+
+int32_t P3T1085_Stats_Init(p3t1085_stats_t *pStats,
+                           const p3t1085_i2c_sensorhandle_t *pSensorHandle,
+                           const uint32_t *pWindowMs)
+{
+    p3t1085_stats_t **ppFree = NULL;
+
+    /*! Check the input parameters. */
+    if ((pStats == NULL) || (pSensorHandle == NULL))
+    {
+        return SENSOR_ERROR_INVALID_PARAM;
+    }
+
+    if (pWindowMs == NULL)
+    {
+        pWindowMs = cStatsDefaultWindowMs;
+    }
+    for (uint8_t i = 0; i < P3T1085_STATS_WINDOW_COUNT; i++)
+    {
+        if (pWindowMs[i] == 0U)
+        {
+            return SENSOR_ERROR_INVALID_PARAM;
+        }
+    }
+
+    /*! Take the slot of the handle, or a free one. */
+    for (uint8_t i = 0; i < P3T1085_STATS_MAX_SENSORS; i++)
+    {
+        if ((gStatsRegistry[i] != NULL) && (gStatsRegistry[i]->pSensorHandle == pSensorHandle))
+        {
+            ppFree = &gStatsRegistry[i];
+            break;
+        }
+        if ((gStatsRegistry[i] == NULL) && (ppFree == NULL))
+        {
+            ppFree = &gStatsRegistry[i];
+        }
+    }
+    if (ppFree == NULL)
+    {
+        return SENSOR_ERROR_INVALID_PARAM;
+    }
+
+    (void)memset(pStats, 0, sizeof(*pStats));
+    pStats->pSensorHandle = pSensorHandle;
+    for (uint8_t i = 0; i < P3T1085_STATS_WINDOW_COUNT; i++)
+    {
+        pStats->windows[i].lengthMs = pWindowMs[i];
+    }
+    *ppFree = pStats;
+
+    return SENSOR_ERROR_NONE;
+}
+
+p3t1085_stats_t *P3T1085_Stats_Find(const p3t1085_i2c_sensorhandle_t *pSensorHandle)
+{
+    for (uint8_t i = 0; i < P3T1085_STATS_MAX_SENSORS; i++)
+    {
+        if ((gStatsRegistry[i] != NULL) && (gStatsRegistry[i]->pSensorHandle == pSensorHandle))
+        {
+            return gStatsRegistry[i];
+        }
+    }
+
+    return NULL;
+}
+
+void P3T1085_Stats_Update(p3t1085_stats_t *pStats, int16_t tempQ4, uint32_t timeMs)
+{
+    p3t1085_stats_window_t *pWindow;
+    p3t1085_stats_sums_t *pSums;
+    uint32_t elapsed;
+    int32_t dev;
+
+    if (!pStats->started)
+    {
+        pStats->started = true;
+        for (uint8_t i = 0; i < P3T1085_STATS_WINDOW_COUNT; i++)
+        {
+            pStats->windows[i].startMs = timeMs;
+        }
+    }
+
+    for (uint8_t i = 0; i < P3T1085_STATS_WINDOW_COUNT; i++)
+    {
+        pWindow = &pStats->windows[i];
+        pSums = &pWindow->sums;
+
+        /* Close the window once the sample is past its end, the windows stay aligned to the
+         * first sample and the one before the new window is empty after a gap in the stream. */
+        elapsed = timeMs - pWindow->startMs;
+        if (elapsed >= pWindow->lengthMs)
+        {
+            if ((elapsed - pWindow->lengthMs) < pWindow->lengthMs)
+            {
+                P3T1085_Stats_Finish(pSums, pWindow->startMs, &pWindow->last);
+            }
+            else
+            {
+                pSums->count = 0U;
+                P3T1085_Stats_Finish(pSums, timeMs - (elapsed % pWindow->lengthMs) - pWindow->lengthMs,
+                                     &pWindow->last);
+            }
+            pWindow->startMs = timeMs - (elapsed % pWindow->lengthMs);
+            pWindow->complete = true;
+            pSums->count = 0U;
+        }
+
+        if (pSums->count == 0U)
+        {
+            pSums->refQ4 = tempQ4;
+            pSums->minQ4 = tempQ4;
+            pSums->maxQ4 = tempQ4;
+            pSums->sum = 0;
+            pSums->sumSq = 0U;
+        }
+        else if (tempQ4 < pSums->minQ4)
+        {
+            pSums->minQ4 = tempQ4;
+        }
+        else if (tempQ4 > pSums->maxQ4)
+        {
+            pSums->maxQ4 = tempQ4;
+        }
+
+        dev = (int32_t)tempQ4 - (int32_t)pSums->refQ4;
+        pSums->count++;
+        pSums->sum += dev;
+        pSums->sumSq += (uint32_t)(dev * dev);
+    }
+}
+
+int32_t P3T1085_Stats_Get(const p3t1085_stats_t *pStats,
+                          enum EStatsWindow eWindow,
+                          bool running,
+                          p3t1085_stats_result_t *pResult)
+{
+    const p3t1085_stats_window_t *pWindow;
+
+    /*! Check the input parameters. */
+    if ((pStats == NULL) || (pResult == NULL) || ((uint32_t)eWindow >= P3T1085_STATS_WINDOW_COUNT))
+    {
+        return SENSOR_ERROR_INVALID_PARAM;
+    }
+
+    pWindow = &pStats->windows[eWindow];
+    if (running)
+    {
+        if (!pStats->started)
+        {
+            return SENSOR_ERROR_INIT;
+        }
+        P3T1085_Stats_Finish(&pWindow->sums, pWindow->startMs, pResult);
+    }
+    else
+    {
+        if (!pWindow->complete)
+        {
+            return SENSOR_ERROR_INIT;
+        }
+        *pResult = pWindow->last;
+    }
+
+    return SENSOR_ERROR_NONE;
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file p3t1085uk_trend.h
+ * @brief The p3t1085uk_trend.h file describes the P3T1085UK temperature trend detector.
+
+    The detector fits a least-squares line through the last readings of the sample stream and
+    projects it to THIGH. When the projected crossing is within the warning horizon it raises an
+    early warning, before the sensor itself asserts ALERT, and clears it once the projection moves
+    beyond the horizon again. The fit is done in 64-bit integers on times taken relative to the
+    newest reading, so readings may come at any interval and the timestamps may wrap.
+*/
+
+#ifndef P3T1085UK_TREND_H_
+#define P3T1085UK_TREND_H_
+
+/* Standard C Includes */
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief Maximum number of readings in the regression window. */
+#ifndef P3T1085_TREND_MAX_LENGTH
+#define P3T1085_TREND_MAX_LENGTH 16
+#endif
+
+/*! @brief Time to threshold when the temperature is not rising. */
+#define P3T1085_TREND_NEVER (0xFFFFFFFFU)
+
+/*! @brief       Notification of an early warning change.
+ *  @param[in]   pUserData          The pointer given to P3T1085_Trend_Init().
+ *  @param[in]   warning            true when a crossing of THIGH is projected within the horizon.
+ *  @param[in]   timeToThresholdMs  The projected time to THIGH, 0 when already reached.
+ */
+typedef void (*p3t1085_trend_callback_t)(void *pUserData, bool warning, uint32_t timeToThresholdMs);
+
+/*!
+ * @brief This defines the trend detector state, all temperatures are in 1/16 celsius units.
+ */
+typedef struct
+{
+    uint8_t length;                             /*!< Readings of the regression window. */
+    uint8_t count;                              /*!< Readings in the window. */
+    uint8_t next;                               /*!< Slot of the next reading. */
+    bool warning;                               /*!< Early warning raised. */
+    int16_t tHighQ4;                            /*!< Threshold the line is projected to. */
+    uint32_t horizonMs;                         /*!< Warning horizon. */
+    int32_t slopeMilliCPerS;                    /*!< Last fitted slope. */
+    uint32_t timeToThresholdMs;                 /*!< Last projected time to THIGH. */
+    p3t1085_trend_callback_t callback;
+    void *pUserData;
+    uint32_t timeMs[P3T1085_TREND_MAX_LENGTH];  /*!< Times of the readings. */
+    int16_t tempQ4[P3T1085_TREND_MAX_LENGTH];   /*!< Readings. */
+} p3t1085_trend_t;
+
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+/*! @brief       The interface function to initialize the trend detector.
+ *  @param[in]   pTrend     the trend detector.
+ *  @param[in]   length     the readings of the regression window, 2 to P3T1085_TREND_MAX_LENGTH.
+ *  @param[in]   tHighQ4    the threshold, THIGH of the sensor configuration.
+ *  @param[in]   horizonMs  the warning horizon.
+ *  @param[in]   callback   the function notified of warning changes, may be NULL.
+ *  @param[in]   pUserData  pointer passed to the callback.
+ *  @constraints None
+ *  @reeentrant  No
+ *  @return      ::P3T1085_Trend_Init() returns the status .
+ */
+int32_t P3T1085_Trend_Init(p3t1085_trend_t *pTrend,
+                           uint8_t length,
+                           int16_t tHighQ4,
+                           uint32_t horizonMs,
+                           p3t1085_trend_callback_t callback,
+                           void *pUserData);
+
+/*! @brief       The interface function to keep the threshold in line with the sensor.
+ *  @details     Call it whenever THIGH is changed, the projection is updated with the next reading.
+ *  @param[in]   pTrend   the trend detector.
+ *  @param[in]   tHighQ4  the threshold.
+ *  @constraints None
+ *  @reeentrant  No
+ *  @return      void.
+ */
+void P3T1085_Trend_SetThreshold(p3t1085_trend_t *pTrend, int16_t tHighQ4);
+
+/*! @brief       The interface function to add a reading.
+ *  @details     This function fits the window once it is full and notifies a warning change.
+ *  @param[in]   pTrend   the trend detector.
+ *  @param[in]   tempQ4   the temperature.
+ *  @param[in]   timeMs   the time of the reading, it must not go back and may wrap.
+ *  @constraints None
+ *  @reeentrant  No
+ *  @return      void.
+ */
+void P3T1085_Trend_Update(p3t1085_trend_t *pTrend, int16_t tempQ4, uint32_t timeMs);
+
+/*! @brief       The interface function to read the last fit.
+ *  @param[in]   pTrend              the trend detector.
+ *  @param[out]  pSlopeMilliCPerS    the slope in 1/1000 celsius per second.
+ *  @param[out]  pTimeToThresholdMs  the projected time to THIGH, 0 when already reached and
+ *                                   P3T1085_TREND_NEVER when not rising.
+ *  @constraints None
+ *  @reeentrant  No
+ *  @return      ::P3T1085_Trend_Get() returns the status, SENSOR_ERROR_INIT until the window is full.
+ */
+int32_t P3T1085_Trend_Get(const p3t1085_trend_t *pTrend, int32_t *pSlopeMilliCPerS, uint32_t *pTimeToThresholdMs);
+
+#endif /* P3T1085UK_TREND_H_ */
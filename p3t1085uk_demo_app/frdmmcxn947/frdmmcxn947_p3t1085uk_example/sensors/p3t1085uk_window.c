@@ -0,0 +1,117 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file p3t1085uk_window.c
+ * @brief The p3t1085uk_window.c file implements the P3T1085UK auto-window thresholds.
+ */
+
+//-----------------------------------------------------------------------
+// ISSDK Includes
+//-----------------------------------------------------------------------
+#include "fsl_common.h"
+#include "p3t1085uk.h"
+#include "p3t1085uk_alarm.h"
+#include "p3t1085uk_window.h"
+#include "sensor_no_heap.h"
+
+//-----------------------------------------------------------------------
+// Macros
+//-----------------------------------------------------------------------
+#define P3T1085_WINDOW_MIN_Q4      ((int32_t)(P3T1085UK_MIN_TLOW_VALUE_CEL * 16))
+#define P3T1085_WINDOW_MAX_Q4      ((int32_t)(P3T1085UK_MAX_THIGH_VALUE_CEL * 16))
+#define P3T1085_WINDOW_MAX_BAND_Q4 (100 * 16)
+
+/* TLOW/THIGH register value of a temperature. */
+#define P3T1085_WINDOW_Q4_TO_REG(q4) ((uint16_t)((uint16_t)(q4) << P3T1085UK_TEMP_CALC_SHIFT))
+
+//-----------------------------------------------------------------------
+// Functions
+//-----------------------------------------------------------------------
+int32_t P3T1085_Window_Init(p3t1085_window_t *pWindow,
+                            p3t1085_i2c_sensorhandle_t *pSensorHandle,
+                            const p3t1085_config_t *pConfig)
+{
+    /*! Check the input parameters. */
+    if ((pWindow == NULL) || (pSensorHandle == NULL) || (pConfig == NULL))
+    {
+        return SENSOR_ERROR_INVALID_PARAM;
+    }
+
+    pWindow->pSensorHandle = pSensorHandle;
+    pWindow->enabled = false;
+    pWindow->bandQ4 = 0;
+    pWindow->tLowQ4 = P3T1085UK_TEMP_REG_TO_Q4(pConfig->tlow);
+    pWindow->tHighQ4 = P3T1085UK_TEMP_REG_TO_Q4(pConfig->thigh);
+    pWindow->writeCount = 0U;
+
+    return SENSOR_ERROR_NONE;
+}
+
+int32_t P3T1085_Window_Enable(p3t1085_window_t *pWindow, bool enable, int16_t bandQ4)
+{
+    if (enable && ((bandQ4 <= 0) || (bandQ4 > P3T1085_WINDOW_MAX_BAND_Q4)))
+    {
+        return SENSOR_ERROR_INVALID_PARAM;
+    }
+
+    pWindow->enabled = enable;
+    if (enable)
+    {
+        pWindow->bandQ4 = bandQ4;
+    }
+
+    return SENSOR_ERROR_NONE;
+}
+
+void P3T1085_Window_SetThresholds(p3t1085_window_t *pWindow, int16_t tLowQ4, int16_t tHighQ4)
+{
+    pWindow->tLowQ4 = tLowQ4;
+    pWindow->tHighQ4 = tHighQ4;
+}
+
+int32_t P3T1085_Window_Recentre(p3t1085_window_t *pWindow, int16_t tempQ4)
+{
+    int32_t status;
+    int32_t tLowQ4;
+    int32_t tHighQ4;
+    registerwritelist16_t writeList[] = {{0}, {0}, __END_WRITE_DATA__};
+
+    if (!pWindow->enabled)
+    {
+        return SENSOR_ERROR_NONE;
+    }
+
+    /* Keep at least one step between the thresholds at either end of the range. */
+    tLowQ4 = MIN(MAX((int32_t)tempQ4 - pWindow->bandQ4, P3T1085_WINDOW_MIN_Q4), P3T1085_WINDOW_MAX_Q4 - 1);
+    tHighQ4 = MIN(MAX((int32_t)tempQ4 + pWindow->bandQ4, P3T1085_WINDOW_MIN_Q4 + 1), P3T1085_WINDOW_MAX_Q4);
+    if ((tLowQ4 == pWindow->tLowQ4) && (tHighQ4 == pWindow->tHighQ4))
+    {
+        return SENSOR_ERROR_NONE;
+    }
+
+    /* Moving up, THIGH goes first so the new TLOW never meets the old THIGH, moving down TLOW goes
+     * first. Either order holds TLOW below THIGH between the two register writes. */
+    writeList[0].writeTo = (tLowQ4 > pWindow->tLowQ4) ? P3T1085UK_THIGH : P3T1085UK_TLOW;
+    writeList[1].writeTo = (tLowQ4 > pWindow->tLowQ4) ? P3T1085UK_TLOW : P3T1085UK_THIGH;
+    for (uint8_t i = 0; i < 2U; i++)
+    {
+        writeList[i].value = P3T1085_WINDOW_Q4_TO_REG((P3T1085UK_THIGH == writeList[i].writeTo) ? tHighQ4 : tLowQ4);
+        writeList[i].mask = 0;
+    }
+
+    status = P3T1085_I2C_WriteData16(pWindow->pSensorHandle, writeList);
+    if (SENSOR_ERROR_NONE != status)
+    {
+        return status;
+    }
+
+    pWindow->tLowQ4 = (int16_t)tLowQ4;
+    pWindow->tHighQ4 = (int16_t)tHighQ4;
+    pWindow->writeCount++;
+
+    return SENSOR_ERROR_NONE;
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file p3t1085uk_window.h
+ * @brief The p3t1085uk_window.h file describes the P3T1085UK auto-window thresholds.
+
+    In interrupt mode ALERT is asserted once when the temperature leaves the TLOW/THIGH window
+    and cleared by the next register read, the ALERT read of the temperature. Re-centring the
+    window on that temperature after each ALERT turns the sensor into a change detector: the
+    next ALERT only comes once the temperature has moved by the band, and the MCU may sleep
+    until then instead of polling. Both thresholds are written by one write list without any
+    read, in the order which keeps TLOW below THIGH after each register write.
+*/
+
+#ifndef P3T1085UK_WINDOW_H_
+#define P3T1085UK_WINDOW_H_
+
+/* Standard C Includes */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* ISSDK Includes */
+#include "p3t1085uk_drv.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*!
+ * @brief This defines the auto-window state, all temperatures are in 1/16 celsius units.
+ */
+typedef struct
+{
+    p3t1085_i2c_sensorhandle_t *pSensorHandle;
+    bool enabled;                 /*!< The window follows the ALERT readings. */
+    int16_t bandQ4;               /*!< Distance of TLOW and THIGH from the centre. */
+    int16_t tLowQ4;               /*!< TLOW of the sensor. */
+    int16_t tHighQ4;              /*!< THIGH of the sensor. */
+    uint32_t writeCount;          /*!< Windows written. */
+} p3t1085_window_t;
+
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+/*! @brief       The interface function to initialize the auto-window of a sensor.
+ *  @details     This function caches TLOW and THIGH of the configuration applied with
+ *               P3T1085_I2C_Configure(), the window starts disabled.
+ *  @param[in]   pWindow        the auto-window state.
+ *  @param[in]   pSensorHandle  handle to the sensor.
+ *  @param[in]   pConfig        the sensor configuration.
+ *  @constraints None
+ *  @reeentrant  No
+ *  @return      ::P3T1085_Window_Init() returns the status .
+ */
+int32_t P3T1085_Window_Init(p3t1085_window_t *pWindow,
+                            p3t1085_i2c_sensorhandle_t *pSensorHandle,
+                            const p3t1085_config_t *pConfig);
+
+/*! @brief       The interface function to enable or disable the auto-window.
+ *  @details     A disabled window leaves the thresholds to the application.
+ *  @param[in]   pWindow  the auto-window state.
+ *  @param[in]   enable   true to re-centre the window on each ALERT reading.
+ *  @param[in]   bandQ4   the band, 1/16 to 100 celsius, ignored when disabling.
+ *  @constraints None
+ *  @reeentrant  No
+ *  @return      ::P3T1085_Window_Enable() returns the status .
+ */
+int32_t P3T1085_Window_Enable(p3t1085_window_t *pWindow, bool enable, int16_t bandQ4);
+
+/*! @brief       The interface function to keep the cached thresholds in line with the sensor.
+ *  @details     Call it whenever TLOW or THIGH is changed by the application.
+ *  @constraints None
+ *  @reeentrant  No
+ *  @return      void.
+ */
+void P3T1085_Window_SetThresholds(p3t1085_window_t *pWindow, int16_t tLowQ4, int16_t tHighQ4);
+
+/*! @brief       The interface function to centre the window on a temperature.
+ *  @details     TLOW and THIGH are set to the temperature minus and plus the band, clamped to
+ *               the sensor range, and written only when they change. Call it with the
+ *               temperature read on each ALERT, the disabled window is left unchanged.
+ *  @param[in]   pWindow  the auto-window state.
+ *  @param[in]   tempQ4   the temperature.
+ *  @constraints Application has to ensure that previous instances of the sensor APIs have exited before invocation.
+ *  @reeentrant  No
+ *  @return      ::P3T1085_Window_Recentre() returns the status of the write, a failed write is repeated by the next call.
+ */
+int32_t P3T1085_Window_Recentre(p3t1085_window_t *pWindow, int16_t tempQ4);
+
+#endif /* P3T1085UK_WINDOW_H_ */
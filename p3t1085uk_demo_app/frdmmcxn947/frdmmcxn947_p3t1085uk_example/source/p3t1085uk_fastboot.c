@@ -0,0 +1,83 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file  p3t1085uk_fastboot.c
+ * @brief One temperature read on the reset clock, before the board initialization.
+ */
+
+#include "fsl_common.h"
+#include "p3t1085uk_fastboot.h"
+
+#if (P3T1085_FAST_BOOT > 0U)
+#include "fsl_lpi2c.h"
+#include "pin_mux.h"
+#include "issdk_hal.h"
+#include "sensor_drv.h"
+#include "p3t1085uk.h"
+#include "p3t1085uk_drv.h"
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/* Called by SystemInit() before the data and bss initialization, so it uses no variable. */
+void SystemInitHook(void)
+{
+    MSDK_EnableCpuCycleCounter();
+    DWT->CYCCNT = 0U;
+}
+
+int32_t P3T1085_FastBoot_Sample(p3t1085_fastboot_t *pSample)
+{
+    uint32_t mainCycles = MSDK_GetCpuCycleCount();
+    uint16_t oneShot = P3T1085UK_CONFIG_VALUE(0U, P3T1085UK_ONESHOT_MODE, 0U, 0U, 0U);
+    uint8_t command[P3T1085UK_REG_SIZE_BYTES] = {(uint8_t)(oneShot >> 8), (uint8_t)oneShot};
+    uint8_t raw[P3T1085UK_REG_SIZE_BYTES];
+    lpi2c_master_config_t config;
+    lpi2c_master_transfer_t transfer = {
+        .flags          = kLPI2C_TransferDefaultFlag,
+        .slaveAddress   = P3T1085_I2C_ADDR,
+        .direction      = kLPI2C_Write,
+        .subaddress     = P3T1085UK_CONFIG,
+        .subaddressSize = 1U,
+        .data           = command,
+        .dataSize       = sizeof(command),
+    };
+    status_t status;
+
+    /* Only the sensor bus: its two pins, its functional clock and the LPI2C master. */
+    I2C_S_INIT_PINS();
+    LPI2C_MasterGetDefaultConfig(&config);
+    config.baudRate_Hz = P3T1085_FAST_BOOT_BAUDRATE;
+    LPI2C_MasterInit(I2C_S_BASE, &config, I2C_S_CLK_FREQ);
+
+    /* Polled, the interrupts are not set up yet. Start one conversion, wait for it, then read it.
+     * The write replaces the whole CONFIG, polarity, thermostat mode and hysteresis included, with
+     * their reset values. This is only right because the later cold configuration or warm snapshot
+     * apply writes CONFIG again before the ALERT output is used. */
+    status = LPI2C_MasterTransferBlocking(I2C_S_BASE, &transfer);
+    if (kStatus_Success == status)
+    {
+        SDK_DelayAtLeastUs(P3T1085_FAST_BOOT_CONVERSION_US, SystemCoreClock);
+        transfer.direction = kLPI2C_Read;
+        transfer.subaddress = P3T1085UK_TEMP;
+        transfer.data = raw;
+        transfer.dataSize = sizeof(raw);
+        status = LPI2C_MasterTransferBlocking(I2C_S_BASE, &transfer);
+    }
+
+    /* Still the reset clock, SystemCoreClock is its default. */
+    pSample->sampleUs = (uint32_t)COUNT_TO_USEC(MSDK_GetCpuCycleCount(), SystemCoreClock);
+    pSample->mainUs = (uint32_t)COUNT_TO_USEC(mainCycles, SystemCoreClock);
+    if (kStatus_Success != status)
+    {
+        return SENSOR_ERROR_READ;
+    }
+    pSample->tempQ4 = (int16_t)((int16_t)(((uint16_t)raw[0] << 8) | raw[1]) >> P3T1085UK_TEMP_CALC_SHIFT);
+
+    return SENSOR_ERROR_NONE;
+}
+#endif /* P3T1085_FAST_BOOT */
@@ -0,0 +1,69 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file p3t1085uk_fastboot.h
+ * @brief Minimal boot path reading one temperature before the board is set up.
+
+    For deployments that cold-boot for every sample. The sample is read at the top of
+    main() on the reset clock: only the pins, clock and registers of the sensor LPI2C
+    instance are set up, one blocking transfer starts a one-shot conversion and, after
+    the conversion time, another reads the temperature register. The clock tree, the
+    other pins, the console and the CMSIS I2C driver come after it. The sensor is left
+    in shutdown mode, the configuration applied after the sample sets its mode again.
+    The CPU cycle counter is started from SystemInitHook(), called by SystemInit()
+    before the data and bss initialization, so the latency covers the startup code.
+    Off by default, define P3T1085_FAST_BOOT to 1 to read and report the sample.
+*/
+
+#ifndef P3T1085UK_FASTBOOT_H_
+#define P3T1085UK_FASTBOOT_H_
+
+#include <stdint.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief Definition to enable the fast boot sample. */
+#ifndef P3T1085_FAST_BOOT
+#define P3T1085_FAST_BOOT 0U
+#endif /* P3T1085_FAST_BOOT */
+
+/*! @brief Bus speed of the fast boot transfer. */
+#define P3T1085_FAST_BOOT_BAUDRATE 400000U
+
+/*! @brief Wait between the one-shot trigger and the read, the conversion time of the data sheet with margin. */
+#ifndef P3T1085_FAST_BOOT_CONVERSION_US
+#define P3T1085_FAST_BOOT_CONVERSION_US 15000U
+#endif
+
+#if (P3T1085_FAST_BOOT > 0U)
+/*!
+ * @brief This defines the sample read at boot.
+ */
+typedef struct
+{
+    int16_t tempQ4;       /*!< Temperature in 1/16 celsius units, set only when the read succeeded. */
+    uint32_t mainUs;      /*!< Time from SystemInit() to main(). */
+    uint32_t sampleUs;    /*!< Time from SystemInit() to the end of the read. */
+} p3t1085_fastboot_t;
+
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+/*!
+ * @brief Read one temperature through the sensor LPI2C instance alone.
+ *
+ * Call it first in main(), before the board initialization. The instance is left
+ * initialized, the CMSIS I2C driver initializes it again.
+ *
+ * @param pSample  The sample and its latency, the latency is set even when a transfer failed.
+ * @return SENSOR_ERROR_NONE, or SENSOR_ERROR_READ when the trigger or the read failed.
+ */
+int32_t P3T1085_FastBoot_Sample(p3t1085_fastboot_t *pSample);
+#endif /* P3T1085_FAST_BOOT */
+
+#endif /* P3T1085UK_FASTBOOT_H_ */
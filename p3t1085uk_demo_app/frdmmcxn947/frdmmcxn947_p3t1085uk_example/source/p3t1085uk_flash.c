@@ -0,0 +1,129 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file  p3t1085uk_flash.c
+ * @brief Erase, program and read of PROGRAM_FLASH1 for the sample log flash store.
+ */
+
+#include "fsl_common.h"
+#include "p3t1085uk_flash.h"
+
+#if (P3T1085_FLASH_LOG > 0U)
+#if defined(__has_include)
+#if !__has_include("fsl_flash.h")
+#error "P3T1085_FLASH_LOG needs the romapi flash driver, add the platform.drivers.romapi component of the SDK."
+#endif
+#endif
+#include <string.h>
+#include "fsl_flash.h"
+#include "sensor_drv.h"
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static flash_config_t s_flashConfig;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/* Reads go through the flash cache, drop it once the array has changed. */
+static void P3T1085_Flash_ClearCache(void)
+{
+#if defined(SYSCON_LPCAC_CTRL_CLR_LPCAC_MASK)
+    SYSCON->LPCAC_CTRL |= SYSCON_LPCAC_CTRL_CLR_LPCAC_MASK;
+#endif
+}
+
+static int32_t P3T1085_Flash_Erase(void *pContext, uint32_t address)
+{
+    status_t status;
+
+    status = FLASH_Erase(&s_flashConfig, FMU0, address, P3T1085_FLASH_SECTOR_SIZE, kFLASH_ApiEraseKey);
+    P3T1085_Flash_ClearCache();
+
+    return (kStatus_Success == status) ? SENSOR_ERROR_NONE : SENSOR_ERROR_WRITE;
+}
+
+static int32_t P3T1085_Flash_Program(void *pContext, uint32_t address, const uint8_t *pData)
+{
+    status_t status;
+
+    status = FLASH_Program(&s_flashConfig, FMU0, address, (uint8_t *)pData, P3T1085_FLASH_PAGE_SIZE);
+    P3T1085_Flash_ClearCache();
+
+    return (kStatus_Success == status) ? SENSOR_ERROR_NONE : SENSOR_ERROR_WRITE;
+}
+
+/* The erase verify command checks the page against the erase margin, it fails on a page whose
+ * program was cut even when the page reads as erased. */
+static int32_t P3T1085_Flash_Blank(void *pContext, uint32_t address)
+{
+    status_t status;
+
+    status = FLASH_VerifyErasePhrase(&s_flashConfig, FMU0, address, P3T1085_FLASH_PAGE_SIZE);
+
+    return (kStatus_Success == status) ? SENSOR_ERROR_NONE : SENSOR_ERROR_READ;
+}
+
+static int32_t P3T1085_Flash_Read(void *pContext, uint32_t address, uint8_t *pData, uint32_t size)
+{
+    uint32_t faultMask;
+    uint32_t ccr;
+    bool fault;
+
+    /* Erased phrases are not read through the bus. */
+    if (kStatus_Success == FLASH_VerifyErasePhrase(&s_flashConfig, FMU0, address, size))
+    {
+        (void)memset(pData, 0xFF, size);
+        return SENSOR_ERROR_NONE;
+    }
+
+    /* The bank is memory mapped, but a page torn by a reset may hold an uncorrectable ECC error
+     * and the read of it is a bus fault. The copy runs at the priority of FAULTMASK with the
+     * bus faults ignored, a fault only sets its status bit and fails the read. */
+    SCB->CFSR = SCB_CFSR_BUSFAULTSR_Msk;
+    faultMask = __get_FAULTMASK();
+    ccr = SCB->CCR;
+    __set_FAULTMASK(1U);
+    SCB->CCR = ccr | SCB_CCR_BFHFNMIGN_Msk;
+    __DSB();
+    __ISB();
+    (void)memcpy(pData, (const void *)(uintptr_t)address, size);
+    __DSB();
+    SCB->CCR = ccr;
+    __ISB();
+    __set_FAULTMASK(faultMask);
+    fault = (SCB->CFSR & (SCB_CFSR_PRECISERR_Msk | SCB_CFSR_IMPRECISERR_Msk)) != 0U;
+    if (fault)
+    {
+        SCB->CFSR = SCB_CFSR_BUSFAULTSR_Msk;
+        P3T1085_Flash_ClearCache();
+    }
+
+    return fault ? SENSOR_ERROR_READ : SENSOR_ERROR_NONE;
+}
+
+int32_t P3T1085_Flash_Init(p3t1085_flash_t *pFlash)
+{
+    if (kStatus_Success != FLASH_Init(&s_flashConfig))
+    {
+        return SENSOR_ERROR_INIT;
+    }
+
+    pFlash->erase      = P3T1085_Flash_Erase;
+    pFlash->program    = P3T1085_Flash_Program;
+    pFlash->read       = P3T1085_Flash_Read;
+    pFlash->blank      = P3T1085_Flash_Blank;
+    pFlash->pContext   = NULL;
+    pFlash->base       = P3T1085_FLASH_BASE;
+    pFlash->size       = P3T1085_FLASH_SIZE;
+    pFlash->sectorSize = P3T1085_FLASH_SECTOR_SIZE;
+    pFlash->pageSize   = P3T1085_FLASH_PAGE_SIZE;
+
+    return SENSOR_ERROR_NONE;
+}
+#endif /* P3T1085_FLASH_LOG */
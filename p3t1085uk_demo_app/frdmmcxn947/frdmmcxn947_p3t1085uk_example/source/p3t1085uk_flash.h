@@ -0,0 +1,53 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file p3t1085uk_flash.h
+ * @brief Flash store of the compressed sample log in the second flash bank of MCXN947.
+
+    The store uses PROGRAM_FLASH1, the 1 MB bank at 0x100000 left free by the linker
+    scripts, through the flash driver of the ROM API. Pages are checked with the erase
+    verify command before they are read or appended to, and the reads of written pages
+    catch the ECC bus faults of a page torn by a reset. It is off by default and not built
+    in the shipped project, whose drivers folder has no romapi flash driver: add the SDK
+    platform.drivers.romapi component (fsl_flash.h and its sources) to drivers/, then define
+    P3T1085_FLASH_LOG to 1 to keep every closed log block in flash across resets.
+*/
+
+#ifndef P3T1085UK_FLASH_H_
+#define P3T1085UK_FLASH_H_
+
+#include <stdint.h>
+#include "p3t1085uk_flashlog.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief Definition to enable the flash store of the sample log. */
+#ifndef P3T1085_FLASH_LOG
+#define P3T1085_FLASH_LOG 0U
+#endif /* P3T1085_FLASH_LOG */
+
+/*! @brief Region of the store, the whole PROGRAM_FLASH1 bank. */
+#define P3T1085_FLASH_BASE        0x100000U
+#define P3T1085_FLASH_SIZE        0x100000U
+#define P3T1085_FLASH_SECTOR_SIZE 8192U
+#define P3T1085_FLASH_PAGE_SIZE   128U
+
+#if (P3T1085_FLASH_LOG > 0U)
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+/*!
+ * @brief Initialize the flash driver and describe the region of the store.
+ *
+ * @param pFlash  The region, to pass to P3T1085_FlashLog_Mount().
+ * @return SENSOR_ERROR_NONE, or SENSOR_ERROR_INIT when the flash driver failed.
+ */
+int32_t P3T1085_Flash_Init(p3t1085_flash_t *pFlash);
+#endif /* P3T1085_FLASH_LOG */
+
+#endif /* P3T1085UK_FLASH_H_ */
@@ -18,6 +18,8 @@
 #include "board.h"
 #include "fsl_debug_console.h"
 #include "stdio.h"
+#include <ctype.h>
+#include <string.h>
 /*******************************************************************************
  * Definitions
  ******************************************************************************/
@@ -30,7 +32,20 @@
 #include "issdk_hal.h"
 #include "gpio_driver.h"
 #include "p3t1085uk_drv.h"
+#include "p3t1085uk_alert.h"
+#include "p3t1085uk_latest.h"
+#include "p3t1085uk_convert.h"
+#include "p3t1085uk_stats.h"
+#include "p3t1085uk_filter.h"
+#include "p3t1085uk_trend.h"
+#include "p3t1085uk_rate.h"
+#include "p3t1085uk_window.h"
+#include "p3t1085uk_log.h"
+#include "p3t1085uk_flash.h"
+#include "p3t1085uk_snapshot.h"
+#include "p3t1085uk_fastboot.h"
 #include "systick_utils.h"
+#include "deferred_log.h"
 
 //-----------------------------------------------------------------------
 // CMSIS Includes
@@ -41,14 +56,77 @@
 //-----------------------------------------------------------------------
 // Macros
 //-----------------------------------------------------------------------
-#define P3T1085_INT1_IRQ      GPIO00_IRQn
-#define P3T1085_INT1_ISR      GPIO00_IRQHandler
+#define CMD_LINE_MAX_LEN      (64U)
+#define CMD_MAX_ARGS          (4U)
+#define CMD_PROMPT            "> "
+#define CMD_TEMP_Q4_SCALE     (16U)   /* 1/16°C steps of the sensor. */
+#define CMD_TEMP_MAX_INT_PART (1000U) /* Parser guard, the sensor range is checked later. */
+#define CMD_STREAM_MAX_HZ     (100U)
+#define CMD_BENCH_SAMPLES     (256U)  /* Readings converted by each step of the bench command. */
+#define ALERT_GLITCH_US       (1000U) /* ALERT pulses shorter than this are ignored. */
+#define TREND_LENGTH          (16U)    /* Streamed readings fitted by the trend detector. */
+#define TREND_HORIZON_MS      (10000U) /* Early warning when THIGH is projected sooner. */
+#define LOG_BUFFER_SIZE       (16U * 1024U) /* Compressed history of the streamed readings. */
+#define SENSOR_BUS_SPEED      (ARM_I2C_BUS_SPEED_FAST) /* Bus speed of a cold boot. */
+
+#ifndef DEBUG_CONSOLE_TRANSFER_NON_BLOCKING
+#error "The command console polls DbgConsole_TryGetchar(), define DEBUG_CONSOLE_TRANSFER_NON_BLOCKING"
+#endif
+
+#define LOG_RECORD_SIZE       (P3T1085_LOG_BLOCK_SIZE + sizeof(p3t1085_log_summary_t)) /* Flash record of a block. */
+
+#if (P3T1085_FLASH_LOG > 0U)
+_Static_assert(LOG_RECORD_SIZE <= P3T1085_FLASH_PAGE_SIZE - P3T1085_FLASHLOG_HEADER_SIZE,
+               "A log block and its summary must fit one flash page with its record header, reduce P3T1085_LOG_BLOCK_SIZE");
+#endif
+
+//-----------------------------------------------------------------------
+// Types
+//-----------------------------------------------------------------------
+/*! @brief Sensor settings addressed by the get and set commands. */
+typedef enum
+{
+	SETTING_THIGH,
+	SETTING_TLOW,
+	SETTING_HYST,
+	SETTING_RATE,
+	SETTING_MODE,
+	SETTING_TM,
+	SETTING_POL,
+	SETTING_COUNT
+} demo_setting_t;
+
+/*! @brief Console command descriptor. */
+typedef struct
+{
+	const char *name;
+	uint32_t argc;
+	const char *usage;
+	void (*handler)(uint32_t argc, char *argv[]);
+} demo_command_t;
 
 // Constants
 //-----------------------------------------------------------------------
-/*! @brief Register settings for Interrupt (non buffered) mode. */
-const registerwritelist_t cP3t1085ConfigNormal[] = {
-		__END_WRITE_DATA__};
+/*! @brief Register settings for comparator mode, folded at compile time into one value per register. */
+const p3t1085_config_t cP3t1085ConfigNormal = P3T1085_CONFIG_INIT(
+		P3T1085UK_CR_4HZ, P3T1085UK_CONT_CONV_MODE, P3T1085UK_TS_COMP, P3T1085UK_POL_ACTIVE_LOW, P3T1085UK_HYST_1C,
+		75.0, 80.0);
+
+/*! @brief Conversion rate policy: 16 Hz within 2°C of a threshold or at 0.5°C/s, 0.25 Hz when stable. */
+static const p3t1085_rate_policy_t cRatePolicy = {
+		.nearQ4 = 2 * CMD_TEMP_Q4_SCALE, .fastMilliCPerS = 500, .holdMs = 10000U,
+		.minRate = P3T1085UK_CR_0_25HZ, .maxRate = P3T1085UK_CR_16HZ};
+
+/*! @brief Setting keywords, indexed by demo_setting_t. */
+static const char *const cSettingNames[SETTING_COUNT] = {"thigh", "tlow", "hyst", "rate", "mode", "tm", "pol"};
+/*! @brief Value keywords, indexed by the driver enums. */
+static const char *const cHystNames[] = {"0", "1", "2", "4"};
+static const char *const cRateNames[] = {"0.25", "1", "4", "16"};
+static const char *const cModeNames[] = {"shutdown", "oneshot", "cont"};
+static const char *const cThermoStatNames[] = {"comp", "int"};
+static const char *const cPolarityNames[] = {"low", "high"};
+static const char *const cAlarmStateNames[] = {"Normal", "Over-Temperature", "Under-Temperature"};
+static const char *const cStatsWindowNames[] = {"1 s", "1 min", "1 h"};
 
 
 //-----------------------------------------------------------------------
@@ -56,6 +134,7 @@ const registerwritelist_t cP3t1085ConfigNormal[] = {
 //-----------------------------------------------------------------------
 
 float temperature = 0;
+int16_t temperatureQ4 = 0;
 ARM_DRIVER_I2C *I2Cdrv = &I2C_S_DRIVER;
 GENERIC_DRIVER_GPIO *pGpioDriver = &Driver_GPIO_KSDK;
 
@@ -66,468 +145,1151 @@ enum EFunctionalMode eFuncModeBuffer;
 enum EThermoStatMode eThermoStatBuffer;
 enum EPolarity ePolarity;
 enum ECRate eECRateBuffer;
-volatile bool gP3t1085IntFlag = false;
+/*! ALERT reading handed from the I2C interrupt to the main loop, its timestamp is the latency from the edge. */
+AT_NONCACHEABLE_SECTION(static p3t1085_latest_t gAlertLatest);
+static uint32_t gAlertSequence = 0;
+static p3t1085_alarm_t gAlarm;
+static bool gAlarmChanged = false;
+
+static char gCmdLine[CMD_LINE_MAX_LEN];
+static uint32_t gCmdLength = 0;
+static bool gCmdOverflow = false;
+static uint32_t gStreamPeriodUs = 0;  /* 0 when streaming is off. */
+static uint32_t gStreamElapsedUs = 0;
+static int32_t gStreamTick;
+static uint32_t gUptimeMs = 0;  /* Time base of the statistics. */
+static uint32_t gUptimeUs = 0;
+static p3t1085_stats_t gStats;
+/*! Streamed readings are filtered: a median of 3 drops single spikes, the low-pass has a time constant of 4 samples. */
+static const p3t1085_filter_stage_config_t cStreamFilter[] = {P3T1085_FILTER_MEDIAN(3U), P3T1085_FILTER_IIR(1U, 4U)};
+static p3t1085_filter_t gFilter;
+static p3t1085_trend_t gTrend;
+static bool gTrendChanged = false;
+static p3t1085_rate_t gRate;
+static p3t1085_window_t gWindow;
+static uint8_t gLogBuffer[LOG_BUFFER_SIZE];
+static p3t1085_log_t gLog;
+#if (P3T1085_FLASH_LOG > 0U)
+static p3t1085_flash_t gFlash;
+static p3t1085_flashlog_t gFlashLog;
+static uint32_t gFlashTimeBaseMs = 0; /* Keeps the record times going up across resets. */
+#endif
+/*! Sensor setup kept through a warm reset, not cleared by the startup code. */
+static p3t1085_snapshot_t gSnapshot __attribute__((section(".noinit")));
+
+/*! Buffers of the bench command. */
+static uint8_t gBenchRaw[2U * CMD_BENCH_SAMPLES];
+static int16_t gBenchQ4[CMD_BENCH_SAMPLES];
+static union
+{
+	float temp[CMD_BENCH_SAMPLES];
+	int32_t milliC[CMD_BENCH_SAMPLES];
+	uint8_t log[4U * CMD_BENCH_SAMPLES];
+} gBenchOut;
 
 //-----------------------------------------------------------------------
 // Functions
 //-----------------------------------------------------------------------
 
-void P3T1085_INT1_ISR(void)
+/*! -----------------------------------------------------------------------
+ *  @brief       Receive the temperature read on an ALERT edge
+ *  @details     Called from the I2C interrupt by the ALERT router, the reading is
+ *               reported from the main loop.
+ *  @return      void  There is no return value.
+ *  -----------------------------------------------------------------------*/
+static void alertReading(void *pUserData, int32_t status, int16_t tempQ4, uint32_t latencyCycles)
 {
-	/* Clear external interrupt flag. */
-	GPIO_GpioClearInterruptFlags(ALERT_LED.base, 1U << ALERT_LED.pinNumber);
-	gP3t1085IntFlag = true;
-	SDK_ISR_EXIT_BARRIER;
+	P3T1085_Latest_Publish(&gAlertLatest, tempQ4, status, latencyCycles);
+	DLOG("ALERT read %.4T in %u cycles\r\n", tempQ4, latencyCycles);
 }
 
+/*! -----------------------------------------------------------------------
+ *  @brief       Note an alarm state change
+ *  @details     Called by P3T1085_Alert_Poll() from the main loop, the change is reported
+ *               by serviceAcquisition().
+ *  @return      void  There is no return value.
+ *  -----------------------------------------------------------------------*/
+static void alarmChanged(void *pUserData, enum EAlarmState from, enum EAlarmState to)
+{
+	gAlarmChanged = true;
+}
 
 /*! -----------------------------------------------------------------------
- *  @brief       Initialize P3T1085UK ALert Interrupt Pin and Enable IRQ
- *  @details     This function initializes P3T1085UK interrupt pin
+ *  @brief       Note an early warning change
+ *  @details     Called by P3T1085_Trend_Update() from the main loop, the change is reported
+ *               by serviceAcquisition().
  *  @return      void  There is no return value.
  *  -----------------------------------------------------------------------*/
-void init_p3t1085_wakeup_int(void)
+static void trendChanged(void *pUserData, bool warning, uint32_t timeToThresholdMs)
 {
-	pGpioDriver->pin_init(&ALERT_LED, GPIO_DIRECTION_IN, NULL, NULL, NULL);
-	EnableIRQ(P3T1085_INT1_IRQ);
+	gTrendChanged = true;
 }
 
+#if (P3T1085_FLASH_LOG > 0U)
+/*! -----------------------------------------------------------------------
+ *  @brief       Keep a closed log block and its summary in flash
+ *  @details     Called by P3T1085_Log_Append() from the main loop. A page program takes
+ *               a fraction of a millisecond, opening a sector adds its erase.
+ *  @return      void  There is no return value.
+ *  -----------------------------------------------------------------------*/
+static void logBlockClosed(void *pUserData, const uint8_t *pBlock, const p3t1085_log_summary_t *pSummary)
+{
+	uint8_t record[LOG_RECORD_SIZE];
+	uint32_t timeMs;
+
+	P3T1085_Log_DecodeBlock(pBlock, NULL, 0U, &timeMs, NULL);
+	memcpy(record, pBlock, P3T1085_LOG_BLOCK_SIZE);
+	memcpy(&record[P3T1085_LOG_BLOCK_SIZE], pSummary, sizeof(*pSummary));
+	if (SENSOR_ERROR_NONE != P3T1085_FlashLog_Append(&gFlashLog, gFlashTimeBaseMs + timeMs, record, sizeof(record)))
+	{
+		PRINTF("\r\nFlash log append failed\r\n");
+	}
+}
+#endif
 
+#if (defined(DLOG_ENABLE) && (DLOG_ENABLE > 0U))
 /*! -----------------------------------------------------------------------
- *  @brief       Take input from User to enter Thigh value in celcius
- *  @details     This static function sets THigh Value as provided by user and print it back
+ *  @brief       Ship raw deferred log records over the debug console
+ *  @details     The records are binary, capture the console output and expand it
+ *               with tools/dlog_decode.py using the ELF image of this build, or the
+ *               dlog_fmt.json table the Debug post-build step writes next to it.
  *  @return      void  There is no return value.
  *  -----------------------------------------------------------------------*/
-static void fModifyThighValue(int get)
+static void dlogConsoleOutput(const uint8_t *pData, size_t size)
 {
-	float fTemp, fTempLow;
+	size_t i;
 
-	P3T1085_I2C_GetTHigh(&p3t1085Driver, &fTemp);
-	if (get)
+	for (i = 0U; i < size; i++)
 	{
-		PRINTF("\r\nCurrent T-High = %f°C\r\n", fTemp);
+		PUTCHAR(pData[i]);
 	}
-	else{
-		PRINTF("\r\nCurrent T-High = %f°C,\r\nEnter T-High value in Celcius (should be less than 127.9375°C)\r\n->", fTemp);
-		SCANF("%f", &fTemp);
+}
+#endif
 
-		if (fTemp > P3T1085UK_MAX_THIGH_VALUE_CEL || fTemp < P3T1085UK_MIN_TLOW_VALUE_CEL)
+
+/*! -----------------------------------------------------------------------
+ *  @brief       Initialize P3T1085UK ALert Interrupt Pin and Enable IRQ
+ *  @details     This function routes the P3T1085UK ALERT pin through the gpio driver,
+ *               each edge reads the temperature asynchronously from the interrupt.
+ *  @return      int32_t  The status of the routing.
+ *  -----------------------------------------------------------------------*/
+int32_t init_p3t1085_wakeup_int(void)
+{
+	return P3T1085_Alert_AddRoute(pGpioDriver, &ALERT_LED, NULL, &p3t1085Driver, alertReading, NULL);
+}
+
+
+/*! -----------------------------------------------------------------------
+ *  @brief       Parse a temperature in Celsius into 1/16 degree Celsius units
+ *  @details     Accepts an optional sign, integer part and fraction ("80.5", "-12.0625").
+ *               The value is rounded to the nearest 0.0625°C step of the sensor.
+ *  @param[in]   pStr  The string to parse.
+ *  @param[out]  pQ4   The parsed temperature.
+ *  @return      bool  true when the whole string is a valid temperature.
+ *  -----------------------------------------------------------------------*/
+static bool parseTempQ4(const char *pStr, int16_t *pQ4)
+{
+	bool negative = false;
+	bool digits = false;
+	uint32_t intPart = 0;
+	uint32_t fracPart = 0;
+	uint32_t fracScale = 1;
+	int32_t q4;
+
+	if ((*pStr == '-') || (*pStr == '+'))
+	{
+		negative = (*pStr == '-');
+		pStr++;
+	}
+	for (; (*pStr >= '0') && (*pStr <= '9'); pStr++)
+	{
+		intPart = (intPart * 10U) + (uint32_t)(*pStr - '0');
+		if (intPart > CMD_TEMP_MAX_INT_PART)
 		{
-			PRINTF("\r\nT-High should be in range from -75°C to 127.9375°C\r\n");
-			return;
+			return false;
 		}
-		P3T1085_I2C_GetTLow(&p3t1085Driver, &fTempLow);
-		if (fTemp <= fTempLow)
+		digits = true;
+	}
+	if (*pStr == '.')
+	{
+		for (pStr++; (*pStr >= '0') && (*pStr <= '9'); pStr++)
 		{
-			PRINTF("\r\nT-High should be greater than T-Low\r\n");
-			return;
-
+			/* Digits beyond the sixth cannot change the rounded 1/16 step. */
+			if (fracScale < 1000000U)
+			{
+				fracPart = (fracPart * 10U) + (uint32_t)(*pStr - '0');
+				fracScale *= 10U;
+			}
+			digits = true;
 		}
-		P3T1085_I2C_SetTHigh(&p3t1085Driver, fTemp);
-		P3T1085_I2C_GetTHigh(&p3t1085Driver, &fTemp);
-
-		PRINTF("Set T-High = %f°C\r\n", fTemp);
 	}
+	if ((!digits) || (*pStr != '\0'))
+	{
+		return false;
+	}
+
+	q4 = (int32_t)((intPart * CMD_TEMP_Q4_SCALE) + (((fracPart * CMD_TEMP_Q4_SCALE) + (fracScale / 2U)) / fracScale));
+	*pQ4 = (int16_t)(negative ? -q4 : q4);
+
+	return true;
 }
 
 /*! -----------------------------------------------------------------------
- *  @brief       Take input from User to enter TLow value in celcius
- *  @details     This static function sets TLow Value as provided by user and print it back
- *  @return      void  There is no return value.
+ *  @brief       Parse a decimal unsigned integer
+ *  @param[in]   pStr   The string to parse.
+ *  @param[out]  pValue The parsed value.
+ *  @return      bool   true when the whole string is a valid number.
  *  -----------------------------------------------------------------------*/
-static void fModifyTlowValue(int get)
+static bool parseUnsigned(const char *pStr, uint32_t *pValue)
 {
-	float fTemp, fTempHigh;
+	uint32_t value = 0;
 
-	P3T1085_I2C_GetTLow(&p3t1085Driver, &fTemp);
-	if (get)
+	if (*pStr == '\0')
 	{
-		PRINTF("\r\nCurrent T-Low = %f°C\r\n", fTemp);
+		return false;
 	}
-	else
+	for (; *pStr != '\0'; pStr++)
 	{
-		PRINTF("\r\nCurrent T-Low = %f°C,\r\nEnter T-Low value in Celcius (should not be less than -75°C)\r\n->", fTemp);
-		SCANF("%f", &fTemp);
-		if (fTemp > P3T1085UK_MAX_THIGH_VALUE_CEL || fTemp < P3T1085UK_MIN_TLOW_VALUE_CEL)
+		if ((*pStr < '0') || (*pStr > '9') || (value > (UINT32_MAX / 10U) - 1U))
 		{
-			PRINTF("\r\nT-Low should be in range from -75°C to 127.9375°C\r\n");
-			return;
+			return false;
 		}
-		P3T1085_I2C_GetTHigh(&p3t1085Driver, &fTempHigh);
-		if (fTemp >= fTempHigh)
-		{
-			PRINTF("\r\nT-Low should be less than T-High\r\n");
-			return;
+		value = (value * 10U) + (uint32_t)(*pStr - '0');
+	}
+	*pValue = value;
 
-		}
-		P3T1085_I2C_SetTLow(&p3t1085Driver, fTemp);
-		P3T1085_I2C_GetTLow(&p3t1085Driver, &fTemp);
+	return true;
+}
 
-		PRINTF("Set TLow = %f°C\r\n", fTemp);
+/*! -----------------------------------------------------------------------
+ *  @brief       Look up a keyword in a table of option names
+ *  @param[in]   pStr     The keyword.
+ *  @param[in]   pOptions The option names, indexed by enum value.
+ *  @param[in]   count    The number of options.
+ *  @return      int32_t  The index of the option, -1 when not found.
+ *  -----------------------------------------------------------------------*/
+static int32_t findOption(const char *pStr, const char *const *pOptions, uint32_t count)
+{
+	uint32_t i;
+
+	for (i = 0U; i < count; i++)
+	{
+		if (strcmp(pStr, pOptions[i]) == 0)
+		{
+			return (int32_t)i;
+		}
 	}
+	return -1;
 }
 
 /*! -----------------------------------------------------------------------
- *  @brief       Take input from User to enter Hysteresis value in celcius
- *  @details     This static function sets Hyst Value as provided by user and print it back
+ *  @brief       Print the current value of a sensor setting
+ *  @param[in]   setting The setting to print.
  *  @return      void  There is no return value.
  *  -----------------------------------------------------------------------*/
-static void fModifyHystValue(int get)
+static void showSetting(demo_setting_t setting)
 {
-	uint32_t uHyst;
+	float fTemp;
+	int32_t status = SENSOR_ERROR_NONE;
 
-	P3T1085_I2C_GetHysteresis(&p3t1085Driver, &eHystBuffer);
-	switch(eHystBuffer)
+	switch (setting)
 	{
-	case P3T1085UK_HYST_0C:
-		PRINTF("\r\nCurrent Hyst = 0°C\r\n");
+	case SETTING_THIGH:
+		status = P3T1085_I2C_GetTHigh(&p3t1085Driver, &fTemp);
+		if (SENSOR_ERROR_NONE == status)
+		{
+			PRINTF("T-High = %f°C\r\n", fTemp);
+		}
 		break;
-	case P3T1085UK_HYST_1C:
-		PRINTF("\r\nCurrent Hyst = 1°C\r\n");
+	case SETTING_TLOW:
+		status = P3T1085_I2C_GetTLow(&p3t1085Driver, &fTemp);
+		if (SENSOR_ERROR_NONE == status)
+		{
+			PRINTF("T-Low = %f°C\r\n", fTemp);
+		}
+		break;
+	case SETTING_HYST:
+		status = P3T1085_I2C_GetHysteresis(&p3t1085Driver, &eHystBuffer);
+		if (SENSOR_ERROR_NONE == status)
+		{
+			PRINTF("Hyst = %s°C\r\n", cHystNames[eHystBuffer]);
+		}
 		break;
-	case P3T1085UK_HYST_2C:
-		PRINTF("\r\nCurrent Hyst = 2°C\r\n");
+	case SETTING_RATE:
+		status = P3T1085_I2C_GetConversionRate(&p3t1085Driver, &eECRateBuffer);
+		if (SENSOR_ERROR_NONE == status)
+		{
+			PRINTF("CRRate = %sHz\r\n", cRateNames[eECRateBuffer]);
+		}
 		break;
-	case P3T1085UK_HYST_4C:
-		PRINTF("\r\nCurrent Hyst = 4°C\r\n");
+	case SETTING_MODE:
+		status = P3T1085_I2C_GetFunctionalMode(&p3t1085Driver, &eFuncModeBuffer);
+		if (SENSOR_ERROR_NONE == status)
+		{
+			PRINTF("Functional mode = %s\r\n", cModeNames[eFuncModeBuffer]);
+		}
+		break;
+	case SETTING_TM:
+		status = P3T1085_I2C_GetThermoStatMode(&p3t1085Driver, &eThermoStatBuffer);
+		if (SENSOR_ERROR_NONE == status)
+		{
+			PRINTF("Thermostat mode = %s\r\n", cThermoStatNames[eThermoStatBuffer]);
+		}
+		break;
+	case SETTING_POL:
+		status = P3T1085_I2C_GetPolarity(&p3t1085Driver, &ePolarity);
+		if (SENSOR_ERROR_NONE == status)
+		{
+			PRINTF("ALERT pin is active %s\r\n", cPolarityNames[ePolarity]);
+		}
 		break;
 	default:
-		PRINTF("\r\nError in getting Hyst\r\n");
+		break;
 	}
-	if(get)
-		return;
+	if (SENSOR_ERROR_NONE != status)
+	{
+		PRINTF("Error in getting %s\r\n", cSettingNames[setting]);
+	}
+}
 
-	PRINTF("Press 0 to set 0°C Hyst Value\r\n");
-	PRINTF("Press 1 to set 1°C(default) Hyst Value\r\n");
-	PRINTF("Press 2 to set 2°C Hyst Value\r\n");
-	PRINTF("Press 3 to set 4°C Hyst Value\r\n");
-	PRINTF("->");
-	SCANF("%u", &uHyst);
+/*! -----------------------------------------------------------------------
+ *  @brief       Keep the sensor registers in the configuration snapshot
+ *  @details     Called after a setting was changed, the next warm reset applies it again.
+ *  @return      void  There is no return value.
+ *  -----------------------------------------------------------------------*/
+static void saveSnapshot(void)
+{
+	if (SENSOR_ERROR_NONE != P3T1085_Snapshot_Capture(&gSnapshot, 0U, &p3t1085Driver))
+	{
+		PRINTF("Snapshot update failed\r\n");
+	}
+}
+
+/*! -----------------------------------------------------------------------
+ *  @brief       Validate and write a temperature threshold
+ *  @details     T-High must stay above T-Low and vice versa, both within the sensor range.
+ *  @param[in]   setting SETTING_THIGH or SETTING_TLOW.
+ *  @param[in]   tempQ4  The threshold in 1/16°C.
+ *  @return      void  There is no return value.
+ *  -----------------------------------------------------------------------*/
+static void setThreshold(demo_setting_t setting, int16_t tempQ4)
+{
+	float fTemp = (float)tempQ4 / (float)CMD_TEMP_Q4_SCALE;
+	float fOther;
 
-	if (uHyst >= 0 && uHyst<= 3)
+	if (fTemp > P3T1085UK_MAX_THIGH_VALUE_CEL || fTemp < P3T1085UK_MIN_TLOW_VALUE_CEL)
+	{
+		PRINTF("Threshold should be in range from -75°C to 127.9375°C\r\n");
+		return;
+	}
+	if (SETTING_THIGH == setting)
 	{
-		P3T1085_I2C_SetHysteresis(&p3t1085Driver, uHyst);
-		P3T1085_I2C_GetHysteresis(&p3t1085Driver, &eHystBuffer);
-		switch(eHystBuffer)
+		P3T1085_I2C_GetTLow(&p3t1085Driver, &fOther);
+		if (fTemp <= fOther)
 		{
-		case P3T1085UK_HYST_0C:
-			PRINTF("Set Hyst = 0°C\r\n");
-			break;
-		case P3T1085UK_HYST_1C:
-			PRINTF("Set Hyst = 1°C\r\n");
-			break;
-		case P3T1085UK_HYST_2C:
-			PRINTF("Set Hyst = 2°C\r\n");
-			break;
-		case P3T1085UK_HYST_4C:
-			PRINTF("Set Hyst = 4°C\r\n");
-			break;
-		default:
-			PRINTF("Error in Setting Hyst\r\n");
+			PRINTF("T-High should be greater than T-Low\r\n");
+			return;
 		}
-
+		P3T1085_I2C_SetTHigh(&p3t1085Driver, fTemp);
+		P3T1085_Alarm_SetThresholds(&gAlarm, gAlarm.tLowQ4, tempQ4);
+		P3T1085_Trend_SetThreshold(&gTrend, tempQ4);
 	}
 	else
-		PRINTF("Invalid Input, try next time\r\n");
+	{
+		P3T1085_I2C_GetTHigh(&p3t1085Driver, &fOther);
+		if (fTemp >= fOther)
+		{
+			PRINTF("T-Low should be less than T-High\r\n");
+			return;
+		}
+		P3T1085_I2C_SetTLow(&p3t1085Driver, fTemp);
+		P3T1085_Alarm_SetThresholds(&gAlarm, tempQ4, gAlarm.tHighQ4);
+	}
+	P3T1085_Rate_SetThresholds(&gRate, gAlarm.tLowQ4, gAlarm.tHighQ4);
+	P3T1085_Window_SetThresholds(&gWindow, gAlarm.tLowQ4, gAlarm.tHighQ4);
+	saveSnapshot();
+	showSetting(setting);
 }
 
 /*! -----------------------------------------------------------------------
- *  @brief       Take input from User to enter Conversion Rate value in Hz
- *  @details     This static function sets CRRate Value as provided by user and print it back
- *  @return      void  There is no return value.
+ *  @brief       Command "temp": read and print the temperature once
+ *  -----------------------------------------------------------------------*/
+static void cmdTemp(uint32_t argc, char *argv[])
+{
+	if (SENSOR_ERROR_NONE != P3T1085_I2C_GetTempQ4(&p3t1085Driver, &temperatureQ4))
+	{
+		PRINTF("Read Failed.\r\n");
+		return;
+	}
+	P3T1085_Alarm_UpdateTemp(&gAlarm, temperatureQ4);
+	PRINTF("Temperature = %.4T°C\r\n", temperatureQ4);
+}
+
+/*! -----------------------------------------------------------------------
+ *  @brief       Command "get <setting>": print a sensor setting
+ *  -----------------------------------------------------------------------*/
+static void cmdGet(uint32_t argc, char *argv[])
+{
+	int32_t setting = findOption(argv[1], cSettingNames, SETTING_COUNT);
+
+	if (setting < 0)
+	{
+		PRINTF("Unknown setting '%s'\r\n", argv[1]);
+		return;
+	}
+	showSetting((demo_setting_t)setting);
+}
+
+/*! -----------------------------------------------------------------------
+ *  @brief       Command "set <setting> <value>": change a sensor setting
  *  -----------------------------------------------------------------------*/
-static void fModifyCRRate(int get)
+static void cmdSet(uint32_t argc, char *argv[])
 {
-	uint32_t uCRRate;
+	int32_t setting = findOption(argv[1], cSettingNames, SETTING_COUNT);
+	int32_t option = -1;
+	int16_t tempQ4;
 
-	P3T1085_I2C_GetConversionRate(&p3t1085Driver, &eECRateBuffer);
-	switch (eECRateBuffer)
+	switch (setting)
 	{
-	case P3T1085UK_CR_0_25HZ:
-		PRINTF("\r\nCurrent CRRate = 0.25Hz\r\n");
+	case SETTING_THIGH:
+	case SETTING_TLOW:
+		if (!parseTempQ4(argv[2], &tempQ4))
+		{
+			PRINTF("Invalid temperature '%s'\r\n", argv[2]);
+			return;
+		}
+		setThreshold((demo_setting_t)setting, tempQ4);
+		return;
+	case SETTING_HYST:
+		option = findOption(argv[2], cHystNames, ARRAY_SIZE(cHystNames));
+		if (option >= 0)
+		{
+			P3T1085_I2C_SetHysteresis(&p3t1085Driver, (enum EHysteresis)option);
+			P3T1085_Alarm_SetHysteresis(&gAlarm, (enum EHysteresis)option);
+		}
+		break;
+	case SETTING_RATE:
+		if (strcmp(argv[2], "auto") == 0)
+		{
+			P3T1085_Rate_Enable(&gRate, true);
+			PRINTF("CRRate follows the thermal activity of the streamed readings\r\n");
+			return;
+		}
+		option = findOption(argv[2], cRateNames, ARRAY_SIZE(cRateNames));
+		if (option >= 0)
+		{
+			P3T1085_Rate_Enable(&gRate, false);
+			P3T1085_I2C_SetConversionRate(&p3t1085Driver, (enum ECRate)option);
+		}
 		break;
-	case P3T1085UK_CR_1HZ:
-		PRINTF("\r\nCurrent CRRate = 1Hz\r\n");
+	case SETTING_MODE:
+		option = findOption(argv[2], cModeNames, ARRAY_SIZE(cModeNames));
+		if (option >= 0)
+		{
+			P3T1085_I2C_SetFunctionalMode(&p3t1085Driver, (enum EFunctionalMode)option);
+		}
 		break;
-	case P3T1085UK_CR_4HZ:
-		PRINTF("\r\nCurrent CRRate = 4Hz\r\n");
+	case SETTING_TM:
+		option = findOption(argv[2], cThermoStatNames, ARRAY_SIZE(cThermoStatNames));
+		if (option >= 0)
+		{
+			P3T1085_I2C_SetThermoStatMode(&p3t1085Driver, (enum EThermoStatMode)option);
+		}
 		break;
-	case P3T1085UK_CR_16HZ:
-		PRINTF("\r\nCurrent CRRate = 16Hz\r\n");
+	case SETTING_POL:
+		option = findOption(argv[2], cPolarityNames, ARRAY_SIZE(cPolarityNames));
+		if (option >= 0)
+		{
+			P3T1085_I2C_SetPolarity(&p3t1085Driver, (enum EPolarity)option);
+			P3T1085_Alarm_SetPolarity(&gAlarm, (enum EPolarity)option);
+		}
 		break;
 	default:
-		PRINTF("\r\nError in getting Coversion Rate Value\r\n");
+		PRINTF("Unknown setting '%s'\r\n", argv[1]);
+		return;
+	}
+
+	if (option < 0)
+	{
+		PRINTF("Invalid value '%s' for %s\r\n", argv[2], argv[1]);
+		return;
 	}
-	if (get)
+	/* The rate policy writes CONFIG from its cached value, pick up the change. */
+	P3T1085_Rate_Resync(&gRate);
+	saveSnapshot();
+	showSetting((demo_setting_t)setting);
+}
+
+/*! -----------------------------------------------------------------------
+ *  @brief       Command "clear <temp>": move the violated threshold to clear the ALERT
+ *  @details     In Over-Temperature the new value replaces T-High and must be above the
+ *               last temperature, in Under-Temperature it replaces T-Low and must be below it.
+ *               The violated threshold is known from the alarm state, without reading the sensor.
+ *  -----------------------------------------------------------------------*/
+static void cmdClear(uint32_t argc, char *argv[])
+{
+	int16_t tempQ4;
+
+	if (!parseTempQ4(argv[1], &tempQ4))
+	{
+		PRINTF("Invalid temperature '%s'\r\n", argv[1]);
 		return;
-	PRINTF("Press 0 to set 0.25Hz Conversion rate\r\n");
-	PRINTF("Press 1 to set 1Hz Conversion rate\r\n");
-	PRINTF("Press 2 to set 4Hz Conversion rate\r\n");
-	PRINTF("Press 3 to set 16Hz Conversion rate\r\n");
-	PRINTF("->");
-	SCANF("%u", &uCRRate);
+	}
 
-	if (uCRRate >= 0 && uCRRate <= 3)
+	if (P3T1085UK_ALARM_OVER == gAlarm.state)
 	{
-		P3T1085_I2C_SetConversionRate(&p3t1085Driver, uCRRate);
-		P3T1085_I2C_GetConversionRate(&p3t1085Driver, &eECRateBuffer);
-		switch (eECRateBuffer)
+		if (tempQ4 <= gAlarm.tempQ4)
 		{
-		case P3T1085UK_CR_0_25HZ:
-			PRINTF("Set CRRate = 0.25Hz\r\n");
-			break;
-		case P3T1085UK_CR_1HZ:
-			PRINTF("Set CRRate = 1Hz\r\n");
-			break;
-		case P3T1085UK_CR_4HZ:
-			PRINTF("Set CRRate = 4Hz\r\n");
-			break;
-		case P3T1085UK_CR_16HZ:
-			PRINTF("Set CRRate = 16Hz\r\n");
-			break;
-		default:
-			PRINTF("Error in setting Coversion Rate Value\r\n");
+			PRINTF("T-High should be greater than current Temperature to clear the interrupt\r\n");
+			return;
 		}
+		setThreshold(SETTING_THIGH, tempQ4);
+	}
+	else if (P3T1085UK_ALARM_UNDER == gAlarm.state)
+	{
+		if (tempQ4 >= gAlarm.tempQ4)
+		{
+			PRINTF("T-Low should be less than current Temperature to clear the interrupt\r\n");
+			return;
+		}
+		setThreshold(SETTING_TLOW, tempQ4);
 	}
 	else
-		PRINTF("Invalid Input, try next time\r\n");
+	{
+		PRINTF("Temperature is within T-Low and T-High, nothing to clear\r\n");
+	}
 }
 
 /*! -----------------------------------------------------------------------
- *  @brief       Take input from User to enter Functional Mode value
- *  @details     This static function sets Functional Mode Value as provided by user and print it back
- *  @return      void  There is no return value.
+ *  @brief       Centre T-Low and T-High on a temperature in auto-window mode
+ *  @details     The processing modules which cache the thresholds follow the new window,
+ *               and the snapshot keeps it for a warm reset.
+ *  @param[in]   tempQ4 The temperature in 1/16°C.
+ *  @return      bool  true when a new window was written.
  *  -----------------------------------------------------------------------*/
-static void fModifyFunctionalMode(int get)
+static bool recentreWindow(int16_t tempQ4)
 {
-	uint32_t uFunctionalMode;
-	char dummy;
+	uint32_t writeCount = gWindow.writeCount;
 
-	P3T1085_I2C_GetFunctionalMode(&p3t1085Driver, &eFuncModeBuffer);
-	switch(eFuncModeBuffer)
+	if (SENSOR_ERROR_NONE != P3T1085_Window_Recentre(&gWindow, tempQ4))
 	{
-	case P3T1085UK_SHUTDOWN_MODE:
-		PRINTF("\r\nCurrently in Shutdown mode\r\n");
-		break;
-	case P3T1085UK_ONESHOT_MODE:
-		PRINTF("\r\nCurrently in Oneshot mode\r\n");
-		break;
-	case P3T1085UK_CONT_CONV_MODE:
-		PRINTF("\r\nCurrently in Continuous mode\r\n");
-		break;
-	default:
-		PRINTF("\r\nError in getting Functional mode\r\n");
+		PRINTF("Auto-window write failed\r\n");
+		return false;
+	}
+	if (writeCount == gWindow.writeCount)
+	{
+		return false;
+	}
+	P3T1085_Alarm_SetThresholds(&gAlarm, gWindow.tLowQ4, gWindow.tHighQ4);
+	P3T1085_Trend_SetThreshold(&gTrend, gWindow.tHighQ4);
+	P3T1085_Rate_SetThresholds(&gRate, gWindow.tLowQ4, gWindow.tHighQ4);
+	saveSnapshot();
+	return true;
+}
+
+/*! -----------------------------------------------------------------------
+ *  @brief       Command "auto <band>": re-centre the thresholds after each ALERT, off stops
+ *  @details     Meant for interrupt mode (set tm int): the ALERT read clears the alert and the
+ *               new window around it makes the next ALERT report a change by the band.
+ *  -----------------------------------------------------------------------*/
+static void cmdAuto(uint32_t argc, char *argv[])
+{
+	int16_t bandQ4;
+
+	if (strcmp(argv[1], "off") == 0)
+	{
+		P3T1085_Window_Enable(&gWindow, false, 0);
+		PRINTF("Thresholds are left to the set and clear commands\r\n");
+		return;
 	}
-	if (get)
+	if (!parseTempQ4(argv[1], &bandQ4) || (SENSOR_ERROR_NONE != P3T1085_Window_Enable(&gWindow, true, bandQ4)))
+	{
+		PRINTF("Invalid band '%s', 0.0625°C to 100°C\r\n", argv[1]);
+		return;
+	}
+	if (SENSOR_ERROR_NONE != P3T1085_I2C_GetTempQ4(&p3t1085Driver, &temperatureQ4))
+	{
+		PRINTF("Read Failed.\r\n");
 		return;
+	}
+	recentreWindow(temperatureQ4);
+	PRINTF("T-Low %.4T°C, T-High %.4T°C follow each ALERT with a band of %.4T°C\r\n", gWindow.tLowQ4,
+			gWindow.tHighQ4, gWindow.bandQ4);
+}
 
-	PRINTF("Press 0 to set Shutdown mode\r\n");
-	PRINTF("Press 1 to set One-shot mode\r\n");
-	PRINTF("Press 2 to set Continuous mode\r\n");
-	PRINTF("->");
-	SCANF("%u", &uFunctionalMode);
+/*! -----------------------------------------------------------------------
+ *  @brief       Command "alert": report the alarm state and the level of the ALERT pin
+ *  -----------------------------------------------------------------------*/
+static void cmdAlert(uint32_t argc, char *argv[])
+{
+	bool active = (ALERT_PinRead() != 0U) == gAlarm.activeHigh;
+
+	PRINTF("Temperature Alert %s, state %s\r\n", active ? "Generated" : "Not Generated",
+			cAlarmStateNames[gAlarm.state]);
+}
+
+/*! -----------------------------------------------------------------------
+ *  @brief       Command "stream <hz>": print the temperature periodically, 0 stops
+ *  -----------------------------------------------------------------------*/
+static void cmdStream(uint32_t argc, char *argv[])
+{
+	uint32_t rate;
 
-	if (uFunctionalMode >=0 && uFunctionalMode <= 2)
+	if (!parseUnsigned(argv[1], &rate) || (rate > CMD_STREAM_MAX_HZ))
 	{
-		P3T1085_I2C_SetFunctionalMode(&p3t1085Driver, uFunctionalMode);
-		P3T1085_I2C_GetFunctionalMode(&p3t1085Driver, &eFuncModeBuffer);
-		switch(eFuncModeBuffer)
-		{
-		case P3T1085UK_SHUTDOWN_MODE:
-			PRINTF("Set Shutdown mode\r\n");
-			break;
-		case P3T1085UK_ONESHOT_MODE:
-			PRINTF("Set Oneshot mode\r\n");
-			break;
-		case P3T1085UK_CONT_CONV_MODE:
-			PRINTF("Set Continuous mode\r\n");
-			break;
-		default:
-			PRINTF("Error in setting Functional mode\r\n");
-		}
+		PRINTF("Stream rate should be 0 (off) to %u Hz\r\n", CMD_STREAM_MAX_HZ);
+		return;
 	}
-	else
-		PRINTF("Invalid Input, try next time\r\n");
+	gStreamPeriodUs = (rate == 0U) ? 0U : (1000000U / rate);
+	gStreamElapsedUs = gStreamPeriodUs;
+	/* The filter time constant is in samples, start again at the new rate. */
+	P3T1085_Filter_Reset(&gFilter);
 }
 
+#if (defined(DLOG_ENABLE) && (DLOG_ENABLE > 0U))
+/*! -----------------------------------------------------------------------
+ *  @brief       Command "dlog": ship the deferred log
+ *  -----------------------------------------------------------------------*/
+static void cmdDlog(uint32_t argc, char *argv[])
+{
+	PRINTF("Deferred log:\r\n");
+	(void)DLog_Flush(dlogConsoleOutput);
+	PRINTF("\r\n");
+}
+#endif
 
 /*! -----------------------------------------------------------------------
- *  @brief       Take input from User to enter Thermostat Mode value
- *  @details     This static function sets Thermostat Mode Value as provided by user and print it back
+ *  @brief       Print the throughput of one conversion step of the bench command
+ *  @param[in]   pName  The step.
+ *  @param[in]   cycles The core cycles taken by CMD_BENCH_SAMPLES readings.
  *  @return      void  There is no return value.
  *  -----------------------------------------------------------------------*/
-static void fModifyThermostatMode(int get)
+static void printBenchResult(const char *pName, uint32_t cycles)
 {
-	uint32_t uThermoStatMode;
+	/* Readings per microsecond, in thousandths. */
+	uint32_t rate = (uint32_t)(((uint64_t)CMD_BENCH_SAMPLES * SystemCoreClock) / ((uint64_t)cycles * 1000U));
+
+	PRINTF("  %s: %u cycles, %u.%03u samples/us\r\n", pName, cycles, rate / 1000U, rate % 1000U);
+}
 
-	P3T1085_I2C_GetThermoStatMode(&p3t1085Driver, &eThermoStatBuffer);
-	switch(eThermoStatBuffer)
+/*! -----------------------------------------------------------------------
+ *  @brief       Measure the compressed log on a room temperature trace
+ *  @details     The trace is sampled at 1 Hz: a drift of one 1/16°C step every 32 s with
+ *               one step of noise on half of the readings, like a quiet room.
+ *  @return      void  There is no return value.
+ *  -----------------------------------------------------------------------*/
+static void benchLog(void)
+{
+	p3t1085_log_t log;
+	uint32_t seed = 1U;
+	uint32_t start;
+	uint32_t encodeCycles;
+	uint32_t decodeCycles;
+	uint32_t bytes;
+	uint32_t count = 0U;
+	uint32_t i;
+
+	for (i = 0U; i < CMD_BENCH_SAMPLES; i++)
 	{
-	case P3T1085UK_TS_COMP:
-		PRINTF("\r\nCurrently in Comparator mode\r\n");
-		break;
-	case P3T1085UK_TS_INT:
-		PRINTF("\r\nCurrently in Interrupt mode\r\n");
-		break;
-	default:
-		PRINTF("\r\nError in getting Thermostat mode\r\n");
+		seed = seed * 1664525U + 1013904223U;
+		gBenchQ4[i] = (int16_t)(360 + (int32_t)(i / 32U) + (((seed >> 30) == 1U) ? 1 : 0) - (((seed >> 30) == 2U) ? 1 : 0));
 	}
-	if (get)
-		return;
 
-	PRINTF("Press 0 to set Comparator mode\r\n");
-	PRINTF("Press 1 to set Interrupt mode\r\n");
-	PRINTF("->");
-	SCANF("%u", &uThermoStatMode);
+	P3T1085_Log_Init(&log, gBenchOut.log, sizeof(gBenchOut.log));
+	start = MSDK_GetCpuCycleCount();
+	for (i = 0U; i < CMD_BENCH_SAMPLES; i++)
+	{
+		P3T1085_Log_Append(&log, gBenchQ4[i], 1000U * i);
+	}
+	encodeCycles = MSDK_GetCpuCycleCount() - start;
+
+	start = MSDK_GetCpuCycleCount();
+	for (i = 0U; i < log.used; i++)
+	{
+		count += P3T1085_Log_DecodeBlock(P3T1085_Log_GetBlock(&log, i), &gBenchQ4[count], CMD_BENCH_SAMPLES - count,
+				NULL, NULL);
+	}
+	decodeCycles = MSDK_GetCpuCycleCount() - start;
+
+	bytes = (log.used - 1U) * P3T1085_LOG_BLOCK_SIZE + P3T1085_LOG_HEADER_SIZE + (log.bitPos + 7U) / 8U;
+	PRINTF("Compressed log of %u readings, %u blocks:\r\n", count, log.used);
+	PRINTF("  append: %u cycles per reading, decode: %u cycles per reading\r\n", encodeCycles / CMD_BENCH_SAMPLES,
+			decodeCycles / CMD_BENCH_SAMPLES);
+	PRINTF("  %u bytes, %u.%02u bits per reading, %u.%02u:1 against 16-bit readings\r\n", bytes,
+			(800U * bytes / CMD_BENCH_SAMPLES) / 100U, (800U * bytes / CMD_BENCH_SAMPLES) % 100U,
+			(200U * CMD_BENCH_SAMPLES / bytes) / 100U, (200U * CMD_BENCH_SAMPLES / bytes) % 100U);
+}
+
+/*! -----------------------------------------------------------------------
+ *  @brief       Command "bench": measure the batch conversion throughput
+ *  -----------------------------------------------------------------------*/
+static void cmdBench(uint32_t argc, char *argv[])
+{
+	uint32_t start;
+	uint32_t i;
+
+	/* Register values over the sensor range, from -40°C up in 0.625°C steps. */
+	for (i = 0U; i < CMD_BENCH_SAMPLES; i++)
+	{
+		uint16_t raw = (uint16_t)((uint16_t)(-40 * (int32_t)CMD_TEMP_Q4_SCALE + (int32_t)i * 10) << 4);
+
+		gBenchRaw[2U * i] = (uint8_t)(raw >> 8);
+		gBenchRaw[2U * i + 1U] = (uint8_t)raw;
+	}
+
+	MSDK_EnableCpuCycleCounter();
+	PRINTF("Conversion of %u readings, %s:\r\n", CMD_BENCH_SAMPLES,
+			(P3T1085_CONVERT_SIMD > 0U) ? "DSP SIMD" : "portable C");
 
-	if (uThermoStatMode >= 0 && uThermoStatMode <= 1)
+	start = MSDK_GetCpuCycleCount();
+	for (i = 0U; i < CMD_BENCH_SAMPLES; i++)
 	{
-		P3T1085_I2C_SetThermoStatMode(&p3t1085Driver, uThermoStatMode);
-		P3T1085_I2C_GetThermoStatMode(&p3t1085Driver, &eThermoStatBuffer);
-		switch(eThermoStatBuffer)
+		gBenchQ4[i] = P3T1085_I2C_TempRawToQ4(&gBenchRaw[2U * i]);
+	}
+	printBenchResult("raw to Q4, one at a time", MSDK_GetCpuCycleCount() - start);
+
+	start = MSDK_GetCpuCycleCount();
+	P3T1085_Convert_RawToQ4(gBenchRaw, gBenchQ4, CMD_BENCH_SAMPLES);
+	printBenchResult("raw to Q4", MSDK_GetCpuCycleCount() - start);
+
+	start = MSDK_GetCpuCycleCount();
+	P3T1085_Convert_Q4ToFloat(gBenchQ4, gBenchOut.temp, CMD_BENCH_SAMPLES);
+	printBenchResult("Q4 to float", MSDK_GetCpuCycleCount() - start);
+
+	start = MSDK_GetCpuCycleCount();
+	P3T1085_Convert_Q4ToMilliC(gBenchQ4, gBenchOut.milliC, CMD_BENCH_SAMPLES);
+	printBenchResult("Q4 to milli-C", MSDK_GetCpuCycleCount() - start);
+
+	benchLog();
+}
+
+/*! -----------------------------------------------------------------------
+ *  @brief       Command "stats": print the statistics of the last complete windows
+ *  -----------------------------------------------------------------------*/
+static void cmdStats(uint32_t argc, char *argv[])
+{
+	p3t1085_stats_t *pStats = P3T1085_Stats_Find(&p3t1085Driver);
+	p3t1085_stats_result_t result;
+	uint32_t i;
+
+	for (i = 0U; i < P3T1085_STATS_WINDOW_COUNT; i++)
+	{
+		if (SENSOR_ERROR_NONE != P3T1085_Stats_Get(pStats, (enum EStatsWindow)i, false, &result))
 		{
-		case P3T1085UK_TS_COMP:
-			PRINTF("\r\nCurrently in Comparator mode\r\n");
-			break;
-		case P3T1085UK_TS_INT:
-			PRINTF("\r\nCurrently in Interrupt mode\r\n");
-			break;
-		default:
-			PRINTF("\r\nError in getting Thermostat mode\r\n");
+			PRINTF("%s: no complete window yet\r\n", cStatsWindowNames[i]);
+		}
+		else if (0U == result.count)
+		{
+			PRINTF("%s: no sample\r\n", cStatsWindowNames[i]);
+		}
+		else
+		{
+			PRINTF("%s: %u samples, min %.4T°C, max %.4T°C, mean %.4T°C, variance %f°C²\r\n",
+					cStatsWindowNames[i], result.count, result.minQ4, result.maxQ4, result.meanQ4,
+					(float)result.varianceQ8 / (float)(CMD_TEMP_Q4_SCALE * CMD_TEMP_Q4_SCALE));
 		}
 	}
-	else
-		PRINTF("Invalid Input, try next time\r\n");
 }
 
 /*! -----------------------------------------------------------------------
- *  @brief       Take input from User to enter Polarity value
- *  @details     This static function sets Polarity Value as provided by user and print it back
- *  @return      void  There is no return value.
+ *  @brief       Command "trend": print the temperature slope and the projected time to T-High
  *  -----------------------------------------------------------------------*/
-static void fModifyPolarity(int get)
+static void cmdTrend(uint32_t argc, char *argv[])
 {
-	uint32_t uEPolarity;
+	int32_t slope;
+	uint32_t timeMs;
 
-	P3T1085_I2C_GetPolarity(&p3t1085Driver, &ePolarity);
-	switch(ePolarity)
+	if (SENSOR_ERROR_NONE != P3T1085_Trend_Get(&gTrend, &slope, &timeMs))
 	{
-	case P3T1085UK_POL_ACTIVE_LOW:
-		PRINTF("\r\nALERT pin is active low\r\n");
-		break;
-	case P3T1085UK_POL_ACTIVE_HIGH:
-		PRINTF("\r\nALERT pin is active high\r\n");
-		break;
-	default:
-		PRINTF("\r\nError in getting Polarity value\r\n");
+		PRINTF("Trend needs %u streamed readings\r\n", TREND_LENGTH);
 	}
-	if (get)
-		return;
+	else if (P3T1085_TREND_NEVER == timeMs)
+	{
+		PRINTF("Slope %d m°C/s, T-High %.4T°C not approached\r\n", slope, gTrend.tHighQ4);
+	}
+	else
+	{
+		PRINTF("Slope %d m°C/s, T-High %.4T°C projected in %u ms\r\n", slope, gTrend.tHighQ4, timeMs);
+	}
+}
 
-	PRINTF("Press 0 to Active Low Polarity\r\n");
-	PRINTF("Press 1 to Active High Polarity\r\n");
-	PRINTF("->");
-	SCANF("%u", &uEPolarity);
+/*! -----------------------------------------------------------------------
+ *  @brief       Command "log <info | dump>": summarize or print the compressed history
+ *  @details     dump prints one line of hex per block, oldest first, expand a capture
+ *               with tools/p3t1085_log_decode.py --hex.
+ *  -----------------------------------------------------------------------*/
+static void cmdLog(uint32_t argc, char *argv[])
+{
+	const uint8_t *pBlock;
+	uint32_t timeMs;
+	uint32_t i;
+	uint32_t j;
+#if (P3T1085_FLASH_LOG > 0U)
+	uint32_t minErase = UINT32_MAX;
+	uint32_t maxErase = 0U;
+#endif
 
-	if (uEPolarity >= 0 && uEPolarity <= 1)
+	if (strcmp(argv[1], "dump") == 0)
 	{
-		P3T1085_I2C_SetPolarity(&p3t1085Driver, uEPolarity);
-		P3T1085_I2C_GetPolarity(&p3t1085Driver, &ePolarity);
-		switch(ePolarity)
+		for (i = 0U; (pBlock = P3T1085_Log_GetBlock(&gLog, i)) != NULL; i++)
 		{
-		case P3T1085UK_POL_ACTIVE_LOW:
-			PRINTF("\r\nALERT pin is active low\r\n");
-			GPIO_SetPinInterruptConfig(ALERT_LED.base, ALERT_LED.pinNumber, kGPIO_InterruptFallingEdge );
-			break;
-		case P3T1085UK_POL_ACTIVE_HIGH:
-			PRINTF("\r\nALERT pin is active high\r\n");
-			GPIO_SetPinInterruptConfig(ALERT_LED.base, ALERT_LED.pinNumber, kGPIO_InterruptRisingEdge);
-			break;
-		default:
-			PRINTF("\r\nError in getting Polarity value\r\n");
+			for (j = 0U; j < P3T1085_LOG_BLOCK_SIZE; j++)
+			{
+				PRINTF("%02x", pBlock[j]);
+			}
+			PRINTF("\r\n");
 		}
+		return;
 	}
-	else
-		PRINTF("Invalid Input, try next time\r\n");
+	if (strcmp(argv[1], "info") != 0)
+	{
+		PRINTF("Usage: log info | dump\r\n");
+		return;
+	}
+#if (P3T1085_FLASH_LOG > 0U)
+	for (i = 0U; i < gFlashLog.sectorCount; i++)
+	{
+		minErase = MIN(minErase, gFlashLog.sectors[i].eraseCount);
+		maxErase = MAX(maxErase, gFlashLog.sectors[i].eraseCount);
+	}
+	PRINTF("Flash: next record %u, %u of %u sectors used, sector erases %u to %u, %u pages and %u erases since reset\r\n",
+			gFlashLog.recordSeq, gFlashLog.usedSectors, gFlashLog.sectorCount, minErase, maxErase,
+			gFlashLog.programCount, gFlashLog.eraseCount);
+#endif
+	if (0U == gLog.used)
+	{
+		PRINTF("Log empty, stream readings to fill it\r\n");
+		return;
+	}
+	P3T1085_Log_DecodeBlock(P3T1085_Log_GetBlock(&gLog, 0U), NULL, 0U, &timeMs, NULL);
+	PRINTF("%u readings logged, %u of %u blocks of %u bytes used, oldest from %u ms\r\n", gLog.sampleCount,
+			gLog.used, gLog.blockCount, P3T1085_LOG_BLOCK_SIZE, timeMs);
 }
 
 /*! -----------------------------------------------------------------------
- *  @brief       Clear the Interrupt Alert Pin in P3T1085UK
- *  @details     This static function clear the alert signal in P3T1085UK
- *  @return      void  There is no return value.
+ *  @brief       Command "query <from_s> <to_s>": summarize the logged readings of a time range
+ *  @details     The range is in seconds of uptime, the blocks inside it are taken from
+ *               their summaries and only the two blocks at its ends are decoded.
  *  -----------------------------------------------------------------------*/
-static void fModifyAlert()
+static void cmdQuery(uint32_t argc, char *argv[])
 {
-	float fTemp, fTempHigh, fTempLow;
+	p3t1085_log_summary_t result;
+	uint32_t fromS;
+	uint32_t toS;
+	uint32_t start;
+	uint32_t cycles;
+
+	if (!parseUnsigned(argv[1], &fromS) || !parseUnsigned(argv[2], &toS) || (toS < fromS) ||
+			(toS >= UINT32_MAX / 1000U))
+	{
+		PRINTF("Usage: query <from_s> <to_s>, seconds of uptime\r\n");
+		return;
+	}
 
-	P3T1085_I2C_GetTemp(&p3t1085Driver, &temperature);
-	P3T1085_I2C_GetTLow(&p3t1085Driver, &fTempLow);
-	P3T1085_I2C_GetTHigh(&p3t1085Driver, &fTempHigh);
+	start = MSDK_GetCpuCycleCount();
+	if (SENSOR_ERROR_NONE != P3T1085_Log_Query(&gLog, fromS * 1000U, toS * 1000U + 999U, &result))
+	{
+		PRINTF("Log empty, stream readings to fill it\r\n");
+		return;
+	}
+	cycles = MSDK_GetCpuCycleCount() - start;
 
-	if(temperature >= fTempHigh)
+	if (0U == result.count)
 	{
-		PRINTF("\r\nEnter the valid High Temperature value to clear the alert pin\r\n");
-		PRINTF("Current T-High = %f°C,\r\nEnter T-High value in Celcius (should be less than 127.9375°C)\r\n->", fTempHigh);
-		SCANF("%f", &fTempHigh);
+		PRINTF("No reading logged from %u s to %u s\r\n", fromS, toS);
+		return;
+	}
+	PRINTF("%u readings from %u s to %u s: min %.4T°C, max %.4T°C, mean %.4T°C, in %u cycles\r\n", result.count,
+			fromS, toS, result.minQ4, result.maxQ4, (int16_t)(result.sumQ4 / (int32_t)result.count), cycles);
+}
+
+/*! -----------------------------------------------------------------------
+ *  @brief       Command "snapshot <info | clear>": show or drop the configuration snapshot
+ *  @details     clear makes the next reset a cold boot with the default configuration.
+ *  -----------------------------------------------------------------------*/
+static void cmdSnapshot(uint32_t argc, char *argv[])
+{
+	const p3t1085_snapshot_sensor_t *pSensor = &gSnapshot.sensors[0];
 
-		if (fTempHigh > P3T1085UK_MAX_THIGH_VALUE_CEL || fTempHigh < P3T1085UK_MIN_TLOW_VALUE_CEL)
+	if (strcmp(argv[1], "clear") == 0)
+	{
+		gSnapshot.magic = 0U;
+		PRINTF("Snapshot cleared, the next reset applies the default configuration\r\n");
+		return;
+	}
+	if (strcmp(argv[1], "info") != 0)
+	{
+		PRINTF("Usage: snapshot info | clear\r\n");
+		return;
+	}
+	if (!P3T1085_Snapshot_IsValid(&gSnapshot) || (0U == gSnapshot.sensorCount))
+	{
+		PRINTF("No snapshot, the next reset applies the default configuration\r\n");
+		return;
+	}
+	PRINTF("Snapshot of %u sensor, %u updates: bus %u address 0x%02x, CONFIG 0x%04x, T-Low %.4T°C, T-High %.4T°C\r\n",
+			gSnapshot.sensorCount, gSnapshot.saveCount, pSensor->busIndex, pSensor->slaveAddress,
+			pSensor->config.config, P3T1085UK_TEMP_REG_TO_Q4(pSensor->config.tlow),
+			P3T1085UK_TEMP_REG_TO_Q4(pSensor->config.thigh));
+}
+
+static void cmdHelp(uint32_t argc, char *argv[]);
+
+/*! @brief Commands of the console, argc includes the command name. */
+static const demo_command_t cCommands[] = {
+	{"help",   1U, "",                   cmdHelp},
+	{"temp",   1U, "",                   cmdTemp},
+	{"get",    2U, "<setting>",          cmdGet},
+	{"set",    3U, "<setting> <value>",  cmdSet},
+	{"clear",  2U, "<temp>",             cmdClear},
+	{"auto",   2U, "<band> | off",       cmdAuto},
+	{"alert",  1U, "",                   cmdAlert},
+	{"stream", 2U, "<hz>",               cmdStream},
+	{"bench",  1U, "",                   cmdBench},
+	{"stats",  1U, "",                   cmdStats},
+	{"trend",  1U, "",                   cmdTrend},
+	{"log",    2U, "info | dump",        cmdLog},
+	{"query",  3U, "<from_s> <to_s>",    cmdQuery},
+	{"snapshot", 2U, "info | clear",     cmdSnapshot},
+#if (defined(DLOG_ENABLE) && (DLOG_ENABLE > 0U))
+	{"dlog",   1U, "",                   cmdDlog},
+#endif
+};
+
+/*! -----------------------------------------------------------------------
+ *  @brief       Command "help": list the commands and setting values
+ *  -----------------------------------------------------------------------*/
+static void cmdHelp(uint32_t argc, char *argv[])
+{
+	uint32_t i;
+
+	PRINTF("Commands:\r\n");
+	for (i = 0U; i < ARRAY_SIZE(cCommands); i++)
+	{
+		PRINTF("  %s %s\r\n", cCommands[i].name, cCommands[i].usage);
+	}
+	PRINTF("Settings:\r\n");
+	PRINTF("  thigh, tlow <temp>     e.g. set thigh 80.5\r\n");
+	PRINTF("  hyst  0 | 1 | 2 | 4\r\n");
+	PRINTF("  rate  0.25 | 1 | 4 | 16\r\n");
+	PRINTF("  mode  shutdown | oneshot | cont\r\n");
+	PRINTF("  tm    comp | int\r\n");
+	PRINTF("  pol   low | high\r\n");
+}
+
+/*! -----------------------------------------------------------------------
+ *  @brief       Split a command line into words and run the command
+ *  @param[in]   pLine The command line, modified in place.
+ *  @return      void  There is no return value.
+ *  -----------------------------------------------------------------------*/
+static void runCommand(char *pLine)
+{
+	char *argv[CMD_MAX_ARGS];
+	uint32_t argc = 0;
+	uint32_t i;
+
+	while (*pLine != '\0')
+	{
+		while (*pLine == ' ')
 		{
-			PRINTF("\r\nT-High should be in range from -75°C to 127.9375°C\r\n");
-			return;
+			*pLine++ = '\0';
 		}
-		if (fTempHigh <= temperature)
+		if (*pLine == '\0')
 		{
-			PRINTF("\r\nT-High should be greater than current Temperature to clear the interrupt\r\n");
-			return;
+			break;
 		}
-		P3T1085_I2C_SetTHigh(&p3t1085Driver, fTempHigh);
-		P3T1085_I2C_GetTHigh(&p3t1085Driver, &fTemp);
-		PRINTF("Set T-High = %f°C\r\n", fTemp);
-	}
-	else if(temperature <= fTempLow)
-	{
-		PRINTF("\r\nEnter the valid Low Temperature value to clear the alert pin\r\n");
-		PRINTF("\r\nCurrent T-Low = %f°C,\r\nEnter T-Low value in Celcius (should not be less than -75°C)\r\n->", fTempLow);
-		SCANF("%f", &fTempLow);
-		if (fTempLow > P3T1085UK_MAX_THIGH_VALUE_CEL || fTempLow < P3T1085UK_MIN_TLOW_VALUE_CEL)
+		if (argc == CMD_MAX_ARGS)
 		{
-			PRINTF("\r\nT-High should be in range from -75°C to 127.9375°C\r\n");
+			PRINTF("Too many arguments\r\n");
 			return;
 		}
-		if (fTempLow >= temperature)
+		argv[argc++] = pLine;
+		while ((*pLine != ' ') && (*pLine != '\0'))
+		{
+			pLine++;
+		}
+	}
+	if (argc == 0U)
+	{
+		return;
+	}
+
+	for (i = 0U; i < ARRAY_SIZE(cCommands); i++)
+	{
+		if (strcmp(argv[0], cCommands[i].name) == 0)
 		{
-			PRINTF("\r\nT-Low should be less than current Temperature to clear the interrupt\r\n");
+			if (argc != cCommands[i].argc)
+			{
+				PRINTF("Usage: %s %s\r\n", cCommands[i].name, cCommands[i].usage);
+				return;
+			}
+			cCommands[i].handler(argc, argv);
 			return;
 		}
-		P3T1085_I2C_SetTLow(&p3t1085Driver, fTempLow);
-		P3T1085_I2C_GetTLow(&p3t1085Driver, &fTemp);
-		PRINTF("Set T-Low = %f°C\r\n", fTemp);
 	}
+	PRINTF("Unknown command '%s', type help\r\n", argv[0]);
+}
+
+/*! -----------------------------------------------------------------------
+ *  @brief       Feed received characters to the command line without blocking
+ *  @details     Characters are collected until CR or LF, then the line is executed.
+ *               Backspace edits the line, tabs are treated as spaces and input is
+ *               lower-cased so commands can be typed or sent from a script.
+ *  @return      void  There is no return value.
+ *  -----------------------------------------------------------------------*/
+static void pollCommandLine(void)
+{
+	char ch;
 
-	P3T1085_I2C_GetThermoStatMode(&p3t1085Driver, &eThermoStatBuffer);
-	if(eThermoStatBuffer == P3T1085UK_TS_INT )
+	while (kStatus_Success == DbgConsole_TryGetchar(&ch))
 	{
-		P3T1085_I2C_GetHysteresis(&p3t1085Driver, &eHystBuffer);
+		if ((ch == '\r') || (ch == '\n'))
+		{
+			if (gCmdOverflow)
+			{
+				PRINTF("\r\nLine too long, ignored\r\n");
+			}
+			else if (gCmdLength != 0U)
+			{
+				PRINTF("\r\n");
+				gCmdLine[gCmdLength] = '\0';
+				runCommand(gCmdLine);
+			}
+			else
+			{
+				/* Empty line, e.g. the LF of a CR LF pair: only reprint the prompt. */
+				if (ch == '\n')
+				{
+					continue;
+				}
+				PRINTF("\r\n");
+			}
+			gCmdLength = 0U;
+			gCmdOverflow = false;
+			PRINTF(CMD_PROMPT);
+		}
+		else if ((ch == '\b') || (ch == 0x7F))
+		{
+			if (gCmdLength != 0U)
+			{
+				gCmdLength--;
+				PRINTF("\b \b");
+			}
+		}
+		else if ((ch >= ' ') || (ch == '\t'))
+		{
+			if (gCmdLength >= (CMD_LINE_MAX_LEN - 1U))
+			{
+				gCmdOverflow = true;
+				continue;
+			}
+			ch = (ch == '\t') ? ' ' : (char)tolower((unsigned char)ch);
+			gCmdLine[gCmdLength++] = ch;
+			PUTCHAR(ch);
+		}
 	}
 }
 
-static void checkAlert()
+/*! -----------------------------------------------------------------------
+ *  @brief       Run periodic acquisition and report ALERT events
+ *  @details     Called on every pass of the main loop, so sampling continues while
+ *               commands are being typed.
+ *  @return      void  There is no return value.
+ *  -----------------------------------------------------------------------*/
+static void serviceAcquisition(void)
 {
-	uint32_t flag = pGpioDriver->read_pin(&ALERT_LED);
-	P3T1085_I2C_GetPolarity(&p3t1085Driver, &ePolarity);
-	if(ePolarity==P3T1085UK_POL_ACTIVE_LOW)
+	p3t1085_reading_t reading;
+	int16_t filteredQ4;
+	enum ECRate rate = gRate.rate;
+	bool print = false;
+	uint32_t elapsedUs = BOARD_SystickElapsedTime_us(&gStreamTick);
+
+	gStreamElapsedUs += elapsedUs;
+	gUptimeUs += elapsedUs;
+	gUptimeMs += gUptimeUs / 1000U;
+	gUptimeUs %= 1000U;
+
+	P3T1085_Alert_Poll();
+	if ((SENSOR_ERROR_NONE == P3T1085_Latest_Read(&gAlertLatest, &reading)) && (reading.sequence != gAlertSequence))
 	{
-		if(flag)
-			PRINTF("\r\nTemperature Alert Not Generated\r\n");
+		gAlertSequence = reading.sequence;
+		if (SENSOR_ERROR_NONE == reading.status)
+		{
+			temperatureQ4 = reading.tempQ4;
+			P3T1085_Alarm_UpdateTemp(&gAlarm, temperatureQ4);
+			P3T1085_Stats_Update(&gStats, temperatureQ4, gUptimeMs);
+			PRINTF("\r\nALERT: Temperature = %.4T°C, read %u us after the edge\r\n", temperatureQ4,
+					(uint32_t)COUNT_TO_USEC(reading.timestamp, SystemCoreClock));
+			if (recentreWindow(temperatureQ4))
+			{
+				PRINTF("Window T-Low %.4T°C, T-High %.4T°C\r\n", gWindow.tLowQ4, gWindow.tHighQ4);
+			}
+		}
 		else
-			PRINTF("\r\nTemperature Alert Generated\r\n");
+		{
+			PRINTF("\r\nALERT: Temperature read failed\r\n");
+		}
+		print = true;
 	}
-	else
+
+	if (gAlarmChanged)
+	{
+		gAlarmChanged = false;
+		switch (gAlarm.state)
+		{
+		case P3T1085UK_ALARM_OVER:
+			PRINTF("\r\nALARM: %s, T-High %.4T°C reached\r\n", cAlarmStateNames[gAlarm.state], gAlarm.tHighQ4);
+			break;
+		case P3T1085UK_ALARM_UNDER:
+			PRINTF("\r\nALARM: %s, T-Low %.4T°C reached\r\n", cAlarmStateNames[gAlarm.state], gAlarm.tLowQ4);
+			break;
+		default:
+			PRINTF("\r\nALARM: %s\r\n", cAlarmStateNames[gAlarm.state]);
+			break;
+		}
+		print = true;
+	}
+
+	if ((gStreamPeriodUs != 0U) && (gStreamElapsedUs >= gStreamPeriodUs))
+	{
+		gStreamElapsedUs = 0U;
+		if (SENSOR_ERROR_NONE == P3T1085_Filter_GetTempQ4(&gFilter, &temperatureQ4, &filteredQ4))
+		{
+			P3T1085_Alarm_UpdateTemp(&gAlarm, temperatureQ4);
+			P3T1085_Stats_Update(&gStats, temperatureQ4, gUptimeMs);
+			P3T1085_Trend_Update(&gTrend, temperatureQ4, gUptimeMs);
+			P3T1085_Rate_Update(&gRate, temperatureQ4, gTrend.slopeMilliCPerS, gUptimeMs);
+			P3T1085_Log_Append(&gLog, temperatureQ4, gUptimeMs);
+			PRINTF("\r\nTemperature = %.4T°C, filtered %.4T°C\r\n", temperatureQ4, filteredQ4);
+			if (rate != gRate.rate)
+			{
+				PRINTF("CRRate = %sHz\r\n", cRateNames[gRate.rate]);
+				saveSnapshot();
+			}
+			print = true;
+		}
+	}
+
+	if (gTrendChanged)
 	{
-		if(flag)
-			PRINTF("\r\nTemperature Alert Generated\r\n");
+		gTrendChanged = false;
+		if (gTrend.warning)
+		{
+			PRINTF("\r\nWARNING: T-High %.4T°C projected in %u ms, rising %d m°C/s\r\n", gTrend.tHighQ4,
+					gTrend.timeToThresholdMs, gTrend.slopeMilliCPerS);
+		}
 		else
-			PRINTF("\r\nTemperature Alert Not Generated\r\n");
+		{
+			PRINTF("\r\nWARNING cleared\r\n");
+		}
+		print = true;
+	}
+
+	/* Restore the prompt and the partially typed command after asynchronous output. */
+	if (print)
+	{
+		gCmdLine[gCmdLength] = '\0';
+		PRINTF(CMD_PROMPT "%s", gCmdLine);
 	}
 }
 
@@ -535,7 +1297,7 @@ static void checkAlert()
 /*! -----------------------------------------------------------------------
  *  @brief       This is the The main function implementation.
  *  @details     This function invokes board initializes routines, then then brings up the sensor and
- *               finally enters an endless loop to continuously read available samples.
+ *               finally enters an endless loop which samples the sensor and serves console commands.
  *  @param[in]   void This is no input parameter.
  *  @return      void  There is no return value.
  *  @constraints None
@@ -544,8 +1306,16 @@ static void checkAlert()
 int main(void)
 {
 	int32_t status;
-	uint32_t input;
-	char dummy;
+	bool warmStart;
+	uint32_t bootCycles;
+	const p3t1085_config_t *pConfig;
+#if (P3T1085_FAST_BOOT > 0U)
+	p3t1085_fastboot_t fastSample;
+	int32_t fastStatus;
+
+	/*! Read one temperature on the reset clock, the board is set up after it. */
+	fastStatus = P3T1085_FastBoot_Sample(&fastSample);
+#endif
 
 #if RTE_I2C2_DMA_EN
 	/* Enable DMA clock. */
@@ -562,10 +1332,28 @@ int main(void)
 	BOARD_BootClockRUN();
 	BOARD_SystickEnable();
 	BOARD_InitDebugConsole();
-	init_p3t1085_wakeup_int();
+#if (defined(DLOG_ENABLE) && (DLOG_ENABLE > 0U))
+	DLog_Init();
+#endif
 
 
 	PRINTF("\r\nISSDK P3T1085UK sensor driver example demonstration with comparator mode.\r\n");
+#if (P3T1085_FAST_BOOT > 0U)
+	if (SENSOR_ERROR_NONE == fastStatus)
+	{
+		PRINTF("\r\nFast boot: Temperature = %.4T°C, read %u us after startup, main() reached after %u us\r\n",
+				fastSample.tempQ4, fastSample.sampleUs, fastSample.mainUs);
+	}
+	else
+	{
+		PRINTF("\r\nFast boot: read failed %u us after startup\r\n", fastSample.sampleUs);
+	}
+#endif
+
+	/*! A valid snapshot left by the last reset gives the bus speed and the sensor setup. */
+	MSDK_EnableCpuCycleCounter();
+	bootCycles = MSDK_GetCpuCycleCount();
+	warmStart = P3T1085_Snapshot_IsValid(&gSnapshot) && (0U != gSnapshot.sensorCount);
 
 	/*! Initialize the I2C driver. */
 	status = I2Cdrv->Initialize(I2C_S_SIGNAL_EVENT);
@@ -584,7 +1372,7 @@ int main(void)
 	}
 
 	/*! Set the I2C bus speed. */
-	status = I2Cdrv->Control(ARM_I2C_BUS_SPEED, ARM_I2C_BUS_SPEED_FAST);
+	status = I2Cdrv->Control(ARM_I2C_BUS_SPEED, warmStart ? gSnapshot.busSpeed : SENSOR_BUS_SPEED);
 	if (ARM_DRIVER_OK != status)
 	{
 		PRINTF("\r\n I2C Control Mode setting Failed\r\n");
@@ -599,102 +1387,112 @@ int main(void)
 		return -1;
 	}
 
-	while (1)/* Forever loop */
+	/*! Warm start: write the registers of the snapshot, without read before or after. */
+	if (warmStart)
 	{
-		status = P3T1085_I2C_GetTemp(&p3t1085Driver, &temperature);
-		PRINTF("\r\nTemperature = %f°C\r\n", temperature);
-		PRINTF("\r\n");
+		warmStart = (SENSOR_ERROR_NONE == P3T1085_Snapshot_Apply(&gSnapshot, 0U, &p3t1085Driver));
+	}
 
-		if (ARM_DRIVER_OK != status)
+	/*! Cold start: apply and verify the complete sensor configuration, then keep it in the snapshot. */
+	if (!warmStart)
+	{
+		status = P3T1085_I2C_Configure(&p3t1085Driver, &cP3t1085ConfigNormal);
+		if (SENSOR_ERROR_NONE != status)
 		{
-			PRINTF("\r\n Read Failed. \r\n");
+			PRINTF("\r\n Sensor Configuration Failed\r\n");
 			return -1;
 		}
-		PRINTF("Main Menu\r\n");
-		PRINTF("**************************\r\n");
-		PRINTF("1.  Continue Read temperature without changing any config value\r\n");
-		PRINTF("2.  Set T-High\r\n");
-		PRINTF("3.  Get T-High\r\n");
-		PRINTF("4.  Set T-Low\r\n");
-		PRINTF("5.  Get T-Low\r\n");
-		PRINTF("6.  Set Hysteresis\r\n");
-		PRINTF("7.  Get Hysteresis\r\n");
-		PRINTF("8.  Set Conversion rate\r\n");
-		PRINTF("9.  Get Conversion rate\r\n");
-		PRINTF("10. Set Functional Mode\r\n");
-		PRINTF("11. Get Functional Mode\r\n");
-		PRINTF("12. Set Thermostat Mode\r\n");
-		PRINTF("13. Get Thermostat Mode\r\n");
-		PRINTF("14. Set Polarity\r\n");
-		PRINTF("15. Get Polarity\r\n");
-		PRINTF("16. Clear ALERT in Under-Tempearture and Over-Temperature Condition\r\n");
-		PRINTF("17. Check ALERT LED\r\n");
-		PRINTF("18. Exit\r\n");
-		PRINTF("**************************\r\n");
-		SCANF("%d", &input);
-		switch (input)
-		{
-		case 1:
-			status = P3T1085_I2C_GetTemp(&p3t1085Driver, &temperature);
-			PRINTF("\r\nCurrent Temperature = %f°C\r\n", temperature);
-			break;
-		case 2:
-			fModifyThighValue(0);
-			break;
-		case 3:
-			fModifyThighValue(1);
-			break;
-		case 4:
-			fModifyTlowValue(0);
-			break;
-		case 5:
-			fModifyTlowValue(1);
-			break;
-		case 6:
-			fModifyHystValue(0);
-			break;
-		case 7:
-			fModifyHystValue(1);
-			break;
-		case 8:
-			fModifyCRRate(0);
-			break;
-		case 9:
-			fModifyCRRate(1);
-			break;
-		case 10:
-			fModifyFunctionalMode(0);
-			break;
-		case 11:
-			fModifyFunctionalMode(1);
-			break;
-		case 12:
-			fModifyThermostatMode(0);
-			break;
-		case 13:
-			fModifyThermostatMode(1);
-			break;
-		case 14:
-			fModifyPolarity(0);
-			break;
-		case 15:
-			fModifyPolarity(1);
-			break;
-		case 16:
-			fModifyAlert();
-			break;
-		case 17:
-			checkAlert();
-			break;
-		case 18:
-			return 0;
-		default:
-			PRINTF("Invalid input, Continuing reading temperature\r\n");
-		}
-		PRINTF("\r\nPress Enter to goto Main Menu\r\n");
-		do
-		{
-			dummy = GETCHAR();
-		} while(dummy != 13);
+		P3T1085_Snapshot_Init(&gSnapshot, SENSOR_BUS_SPEED);
+		P3T1085_Snapshot_Set(&gSnapshot, 0U, &p3t1085Driver, &cP3t1085ConfigNormal);
+	}
+	/*! The modules below cache the registers from the snapshot instead of reading them. */
+	pConfig = &gSnapshot.sensors[0].config;
+
+	/*! Read the temperature from the ALERT edge. */
+	status = init_p3t1085_wakeup_int();
+	if (SENSOR_ERROR_NONE != status)
+	{
+		PRINTF("\r\n ALERT Initialization Failed\r\n");
+		return -1;
+	}
+
+	/*! Track the alarm state from the ALERT level, seeded with one temperature reading. */
+	status = P3T1085_I2C_GetTempQ4(&p3t1085Driver, &temperatureQ4);
+	if (SENSOR_ERROR_NONE == status)
+	{
+		bootCycles = MSDK_GetCpuCycleCount() - bootCycles;
+		PRINTF("\r\n%s start, %u registers written, first reading %.4T°C after %u us\r\n",
+				warmStart ? "Warm" : "Cold", P3T1085_SNAPSHOT_REG_COUNT, temperatureQ4,
+				(uint32_t)COUNT_TO_USEC(bootCycles, SystemCoreClock));
+		status = P3T1085_Alarm_Init(&gAlarm, pConfig, temperatureQ4,
+				(uint32_t)USEC_TO_COUNT(ALERT_GLITCH_US, SystemCoreClock), alarmChanged, NULL);
+	}
+	if (SENSOR_ERROR_NONE == status)
+	{
+		status = P3T1085_Alert_AttachAlarm(&p3t1085Driver, &gAlarm);
+	}
+	if (SENSOR_ERROR_NONE == status)
+	{
+		/*! Both edges, whatever the polarity: the release edge returns the alarm to normal. */
+		ALERT_SetInterruptConfig(kGPIO_InterruptEitherEdge);
+	}
+	if (SENSOR_ERROR_NONE != status)
+	{
+		PRINTF("\r\n Alarm Initialization Failed\r\n");
+		return -1;
+	}
+
+	/*! Summarize the sampled temperatures over 1 s, 1 min and 1 h windows, filter the stream,
+	 *  project it to T-High, adapt the conversion rate to it and log it, let the thresholds follow ALERT. */
+	status = P3T1085_Stats_Init(&gStats, &p3t1085Driver, NULL);
+	if (SENSOR_ERROR_NONE == status)
+	{
+		status = P3T1085_Filter_Init(&gFilter, &p3t1085Driver, cStreamFilter, ARRAY_SIZE(cStreamFilter));
+	}
+	if (SENSOR_ERROR_NONE == status)
+	{
+		status = P3T1085_Trend_Init(&gTrend, TREND_LENGTH, gAlarm.tHighQ4, TREND_HORIZON_MS, trendChanged, NULL);
+	}
+	if (SENSOR_ERROR_NONE == status)
+	{
+		status = P3T1085_Rate_Init(&gRate, &p3t1085Driver, pConfig, &cRatePolicy);
+	}
+	if (SENSOR_ERROR_NONE == status)
+	{
+		status = P3T1085_Window_Init(&gWindow, &p3t1085Driver, pConfig);
+	}
+	if (SENSOR_ERROR_NONE == status)
+	{
+		status = P3T1085_Log_Init(&gLog, gLogBuffer, sizeof(gLogBuffer));
+	}
+#if (P3T1085_FLASH_LOG > 0U)
+	/*! Keep the closed log blocks in PROGRAM_FLASH1, recovering the store left by the last reset. */
+	if (SENSOR_ERROR_NONE == status)
+	{
+		status = P3T1085_Flash_Init(&gFlash);
+	}
+	if (SENSOR_ERROR_NONE == status)
+	{
+		status = P3T1085_FlashLog_Mount(&gFlashLog, &gFlash);
+	}
+	if (SENSOR_ERROR_NONE == status)
+	{
+		gFlashTimeBaseMs = (0U != gFlashLog.usedSectors) ? gFlashLog.lastTimeMs + 1U : 0U;
+		P3T1085_Log_SetSink(&gLog, logBlockClosed, NULL);
+	}
+#endif
+	if (SENSOR_ERROR_NONE != status)
+	{
+		PRINTF("\r\n Stream Processing Initialization Failed\r\n");
+		return -1;
+	}
+
+	PRINTF("\r\nType help for the list of commands.\r\n" CMD_PROMPT);
+	BOARD_SystickStart(&gStreamTick);
+
+	while (1)/* Forever loop */
+	{
+		pollCommandLine();
+		serviceAcquisition();
 	}
 }
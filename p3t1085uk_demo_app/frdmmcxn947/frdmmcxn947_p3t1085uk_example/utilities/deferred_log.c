@@ -0,0 +1,135 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file  deferred_log.c
+ * @brief Deferred logging: a RAM ring of (format ID, raw argument) records which is
+ *        shipped unformatted and expanded on the host.
+ */
+
+#include <stdarg.h>
+#include "fsl_common.h"
+#include "deferred_log.h"
+
+#if (defined(DLOG_ENABLE) && (DLOG_ENABLE > 0U))
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define DLOG_BUFFER_MASK (DLOG_BUFFER_WORDS - 1U)
+
+#if ((DLOG_BUFFER_WORDS & DLOG_BUFFER_MASK) != 0U)
+#error "DLOG_BUFFER_WORDS must be a power of two"
+#endif
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static uint32_t s_dlogRing[DLOG_BUFFER_WORDS];
+static volatile uint32_t s_dlogHead;    /* Free running write index, advanced by writers. */
+static volatile uint32_t s_dlogTail;    /* Free running read index, advanced by the flush. */
+static volatile uint32_t s_dlogDropped; /* Records lost because the ring was full. */
+
+/* Start of the DLOG_FMT_SECTION section, defined by the linker. */
+extern const char __start_dlog_fmt[];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+void DLog_Init(void)
+{
+    uint32_t primask = DisableGlobalIRQ();
+
+    s_dlogHead    = 0U;
+    s_dlogTail    = 0U;
+    s_dlogDropped = 0U;
+
+    EnableGlobalIRQ(primask);
+}
+
+void DLog_Write(const char *fmt, uint32_t nargs, ...)
+{
+    uint32_t args[DLOG_MAX_ARGS];
+    uint32_t primask;
+    uint32_t head;
+    uint32_t i;
+    va_list ap;
+
+    if (nargs > DLOG_MAX_ARGS)
+    {
+        nargs = DLOG_MAX_ARGS;
+    }
+
+    /* Collect the arguments before entering the critical section. */
+    va_start(ap, nargs);
+    for (i = 0U; i < nargs; i++)
+    {
+        args[i] = va_arg(ap, uint32_t);
+    }
+    va_end(ap);
+
+    primask = DisableGlobalIRQ();
+    head    = s_dlogHead;
+    if ((head - s_dlogTail + 1U + nargs) > DLOG_BUFFER_WORDS)
+    {
+        s_dlogDropped++;
+    }
+    else
+    {
+        s_dlogRing[head & DLOG_BUFFER_MASK] =
+            (nargs << DLOG_NARGS_SHIFT) | ((uint32_t)(fmt - __start_dlog_fmt) & DLOG_ID_MASK);
+        for (i = 0U; i < nargs; i++)
+        {
+            s_dlogRing[(head + 1U + i) & DLOG_BUFFER_MASK] = args[i];
+        }
+        s_dlogHead = head + 1U + nargs;
+    }
+    EnableGlobalIRQ(primask);
+}
+
+uint32_t DLog_Flush(dlog_output_t output)
+{
+    uint32_t header[2];
+    uint32_t primask;
+    uint32_t head;
+    uint32_t tail;
+    uint32_t start;
+    uint32_t span;
+
+    if (NULL == output)
+    {
+        return 0U;
+    }
+
+    /* Snapshot the pending range and the dropped count atomically. */
+    primask       = DisableGlobalIRQ();
+    head          = s_dlogHead;
+    tail          = s_dlogTail;
+    start         = tail;
+    header[1]     = s_dlogDropped;
+    s_dlogDropped = 0U;
+    EnableGlobalIRQ(primask);
+
+    header[0] = DLOG_SYNC_WORD;
+    output((const uint8_t *)&header[0], sizeof(header));
+
+    /* Records are shipped in at most two contiguous spans of the ring. */
+    while (tail != head)
+    {
+        span = DLOG_BUFFER_WORDS - (tail & DLOG_BUFFER_MASK);
+        if (span > (head - tail))
+        {
+            span = head - tail;
+        }
+        output((const uint8_t *)&s_dlogRing[tail & DLOG_BUFFER_MASK], span * sizeof(uint32_t));
+        tail += span;
+        s_dlogTail = tail;
+    }
+
+    return head - start;
+}
+
+#endif /* DLOG_ENABLE */
@@ -0,0 +1,379 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host check and benchmark of the ALERT router (sensors/p3t1085uk_alert.c) and of the
+ * asynchronous register read of interfaces/register_io_i2c.c it starts from the GPIO interrupt.
+ *
+ * The sources are built unchanged against a mock CMSIS I2C driver on instance 2, the shield bus,
+ * with two sensors at 0x48 and 0x49. The mock holds one transfer in flight and refuses another
+ * with ARM_DRIVER_ERROR_BUSY, like the LPI2C CMSIS driver. The checks:
+ *   - an edge reads the Temp register of its own sensor, the offset then the data after a
+ *     repeated start, and delivers the reading from the I2C completion,
+ *   - an edge which finds the bus busy with the read of the other sensor is started when that
+ *     read completes,
+ *   - a NACK on the data phase aborts the transfer and delivers SENSOR_ERROR_READ,
+ *   - an edge during a blocking transfer is refused, then started by P3T1085_Alert_Poll(),
+ *   - a blocking read waits for the asynchronous read in flight,
+ *   - with an alarm attached, the assertion edge reads and raises the alarm, the release edge
+ *     returns it to normal without a read,
+ *   - the route of the board ALERT pin, sensor A on ALERT_LED, samples the pin with
+ *     ALERT_PinRead(), without a read_pin call through the gpio driver.
+ * Then the CPU time of the interrupt path of one ALERT reading, from the edge handler to the
+ * callback, is measured with the mock completing each transfer at once, so the bus time is
+ * excluded, and compared with the blocking P3T1085_I2C_GetTempQ4(). The host clock is the cycle
+ * counter, so the latency reported to the callback is in nanoseconds.
+ *
+ * Build and run from this directory:
+ *   E=../frdmmcxn947/frdmmcxn947_p3t1085uk_example
+ *   gcc -O2 -Wall -Wno-unused-variable -Ihost -I$E/interfaces -I$E/sensors -I$E/utilities -I$E/gpio_driver \
+ *       -I$E/CMSIS_driver/Include -o alert_route_test alert_route_test.c $E/sensors/p3t1085uk_alert.c \
+ *       $E/sensors/p3t1085uk_alarm.c $E/sensors/p3t1085uk_drv.c $E/interfaces/register_io_i2c.c \
+ *       $E/interfaces/sensor_io_i2c.c
+ *   ./alert_route_test [--iterations N]
+ * The warning disabled comes from unused locals of sensors/p3t1085uk_drv.c.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "issdk_hal.h"
+#include "p3t1085uk_alert.h"
+
+#define TEST_SENSOR_A   (0x48U)
+#define TEST_SENSOR_B   (0x49U)
+#define TEST_TEMP_A_Q4  (400)  /* 25.0 C */
+#define TEST_TEMP_B_Q4  (-400) /* -25.0 C */
+#define TEST_MAX_ROUTES (2U)
+
+typedef struct
+{
+    uint32_t count;
+    int32_t status;
+    int16_t tempQ4;
+    uint32_t latency;
+} test_reading_t;
+
+LPI2C_Type g_hostLpi2c[3];
+
+extern void I2C2_SignalEvent_t(uint32_t event);
+
+/* Mock bus state. */
+static bool s_busBusy;
+static bool s_immediate;
+static uint32_t s_pendingEvent;
+static uint16_t s_lastAddress;
+static uint8_t s_lastOffset;
+static uint8_t *s_pRxData;
+static uint32_t s_rxSize;
+static uint16_t s_nackAddress;
+static uint32_t s_aborts;
+static uint32_t s_transmits;
+static uint32_t s_receives;
+static gpio_isr_handler_t s_edgeDuringTransmit;
+static void *s_edgeDuringTransmitData;
+
+/* Mock GPIO: the handlers installed by the router. */
+static gpio_isr_handler_t s_edgeHandler[TEST_MAX_ROUTES];
+static void *s_edgeData[TEST_MAX_ROUTES];
+static uint32_t s_pinLevel[TEST_MAX_ROUTES];
+static uint32_t s_pinReads;
+static uint32_t s_handlerCount;
+
+static test_reading_t s_readings[TEST_MAX_ROUTES];
+
+GPIO_Type g_hostGpio0;
+gpioHandleKSDK_t ALERT_LED = GPIO_PIN_HANDLE_INIT(ALERT);
+
+void BOARD_DELAY_ms(uint32_t delay_ms)
+{
+    (void)delay_ms;
+}
+
+static int16_t SensorTemp(uint16_t address)
+{
+    return (address == TEST_SENSOR_A) ? TEST_TEMP_A_Q4 : TEST_TEMP_B_Q4;
+}
+
+static void BusComplete(void)
+{
+    uint32_t event = s_pendingEvent;
+    uint16_t raw;
+
+    if (!s_busBusy)
+    {
+        return;
+    }
+    if ((s_pRxData != NULL) && (event == ARM_I2C_EVENT_TRANSFER_DONE))
+    {
+        raw = (uint16_t)((uint16_t)SensorTemp(s_lastAddress) << P3T1085UK_TEMP_CALC_SHIFT);
+        s_pRxData[0] = (uint8_t)(raw >> 8);
+        if (s_rxSize > 1U)
+        {
+            s_pRxData[1] = (uint8_t)raw;
+        }
+    }
+    s_pRxData = NULL;
+    s_busBusy = false;
+    I2C2_SignalEvent_t(event);
+}
+
+static int32_t BusTransmit(uint32_t addr, const uint8_t *data, uint32_t num, bool xfer_pending)
+{
+    (void)num;
+    (void)xfer_pending;
+
+    if (s_edgeDuringTransmit != NULL)
+    {
+        /* An ALERT edge interrupts the caller just before its transfer starts. */
+        gpio_isr_handler_t handler = s_edgeDuringTransmit;
+
+        s_edgeDuringTransmit = NULL;
+        handler(s_edgeDuringTransmitData);
+    }
+    if (s_busBusy)
+    {
+        return ARM_DRIVER_ERROR_BUSY;
+    }
+    s_transmits++;
+    s_busBusy = true;
+    s_lastAddress = (uint16_t)addr;
+    s_lastOffset = data[0];
+    s_pendingEvent = ARM_I2C_EVENT_TRANSFER_DONE;
+    if (s_immediate)
+    {
+        BusComplete();
+    }
+    return ARM_DRIVER_OK;
+}
+
+static int32_t BusReceive(uint32_t addr, uint8_t *data, uint32_t num, bool xfer_pending)
+{
+    (void)xfer_pending;
+
+    if (s_busBusy)
+    {
+        return ARM_DRIVER_ERROR_BUSY;
+    }
+    s_receives++;
+    s_busBusy = true;
+    s_lastAddress = (uint16_t)addr;
+    s_pRxData = data;
+    s_rxSize = num;
+    s_pendingEvent = (addr == s_nackAddress) ? (ARM_I2C_EVENT_TRANSFER_INCOMPLETE | ARM_I2C_EVENT_ADDRESS_NACK) :
+                                               ARM_I2C_EVENT_TRANSFER_DONE;
+    if (s_immediate)
+    {
+        BusComplete();
+    }
+    return ARM_DRIVER_OK;
+}
+
+static int32_t BusControl(uint32_t control, uint32_t arg)
+{
+    (void)arg;
+
+    if (control == ARM_I2C_ABORT_TRANSFER)
+    {
+        s_aborts++;
+    }
+    return ARM_DRIVER_OK;
+}
+
+static ARM_DRIVER_I2C s_bus = {
+    .MasterTransmit = BusTransmit,
+    .MasterReceive = BusReceive,
+    .Control = BusControl,
+};
+
+static void PinInit(
+    pinID_t aPinId, gpio_direction_t dir, void *apPinConfig, gpio_isr_handler_t aIsrHandler, void *apUserData)
+{
+    (void)aPinId;
+    (void)dir;
+    (void)apPinConfig;
+
+    s_edgeHandler[s_handlerCount] = aIsrHandler;
+    s_edgeData[s_handlerCount] = apUserData;
+    s_handlerCount++;
+}
+
+static uint32_t PinRead(pinID_t aPinId)
+{
+    s_pinReads++;
+    return s_pinLevel[(uintptr_t)aPinId - 1U];
+}
+
+static GENERIC_DRIVER_GPIO s_gpio = {.pin_init = PinInit, .read_pin = PinRead};
+
+/* The idle function of the blocking transfers: the bus interrupt fires while they wait. */
+static void BusIdle(void *userParam)
+{
+    (void)userParam;
+    BusComplete();
+}
+
+static void OnReading(void *pUserData, int32_t status, int16_t tempQ4, uint32_t latencyCycles)
+{
+    test_reading_t *pReading = &s_readings[(uintptr_t)pUserData];
+
+    pReading->count++;
+    pReading->status = status;
+    pReading->tempQ4 = tempQ4;
+    pReading->latency = latencyCycles;
+}
+
+static void Edge(uint32_t route)
+{
+    s_edgeHandler[route](s_edgeData[route]);
+}
+
+static unsigned long Check(bool condition, const char *pWhat)
+{
+    if (!condition)
+    {
+        printf("FAILED: %s\n", pWhat);
+        return 1U;
+    }
+    return 0U;
+}
+
+int main(int argc, char *argv[])
+{
+    p3t1085_i2c_sensorhandle_t sensorA = {
+        .deviceInfo = {.idleFunction = BusIdle, .deviceInstance = I2C_S_DEVICE_INDEX},
+        .pCommDrv = &s_bus,
+        .isInitialized = true,
+        .slaveAddress = TEST_SENSOR_A,
+    };
+    p3t1085_i2c_sensorhandle_t sensorB = sensorA;
+    const p3t1085_config_t alarmConfig = {
+        .config = ((uint16_t)P3T1085UK_TS_COMP << P3T1085UK_CONFIG_TM_SHIFT) | P3T1085UK_CONFIG_POL_MASK,
+        .tlow = (uint16_t)(((TEST_TEMP_A_Q4 - 160) * 16) & 0xFFFF),
+        .thigh = (uint16_t)(((TEST_TEMP_A_Q4 + 48) * 16) & 0xFFFF),
+    };
+    p3t1085_alarm_t alarm;
+    uint32_t transmits;
+    unsigned long iterations = 1000000U;
+    unsigned long errors = 0U;
+    uint64_t latencySum = 0U;
+    uint32_t start;
+    double blockingNs;
+    int16_t tempQ4 = 0;
+    int i;
+
+    for (i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--iterations") == 0) && (i + 1 < argc))
+        {
+            iterations = strtoul(argv[++i], NULL, 0);
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [--iterations N]\n", argv[0]);
+            return 2;
+        }
+    }
+    sensorB.slaveAddress = TEST_SENSOR_B;
+
+    errors += Check(P3T1085_Alert_AddRoute(&s_gpio, &ALERT_LED, NULL, &sensorA, OnReading, (void *)0) ==
+                        SENSOR_ERROR_NONE,
+                    "route of sensor A");
+    errors += Check(P3T1085_Alert_AddRoute(&s_gpio, (pinID_t)2, NULL, &sensorB, OnReading, (void *)1) ==
+                        SENSOR_ERROR_NONE,
+                    "route of sensor B");
+    errors += Check(s_handlerCount == TEST_MAX_ROUTES, "both ALERT pins installed through pin_init");
+
+    /* Edge A starts its read, edge B finds the bus busy and waits for it. */
+    Edge(0U);
+    errors += Check(s_busBusy && (s_lastAddress == TEST_SENSOR_A) && (s_lastOffset == P3T1085UK_TEMP),
+                    "edge A sends the Temp offset to sensor A");
+    Edge(1U);
+    errors += Check((s_transmits == 1U) && (s_lastAddress == TEST_SENSOR_A),
+                    "edge B waits while the read of A is in flight");
+    BusComplete();
+    errors += Check(s_receives == 1U, "data phase of A after the offset");
+    BusComplete();
+    errors += Check((s_readings[0].count == 1U) && (s_readings[0].status == SENSOR_ERROR_NONE) &&
+                        (s_readings[0].tempQ4 == TEST_TEMP_A_Q4),
+                    "reading of A delivered");
+    errors += Check(s_busBusy && (s_lastAddress == TEST_SENSOR_B), "deferred read of B started on completion of A");
+
+    /* The data phase of B is not acknowledged. */
+    s_nackAddress = TEST_SENSOR_B;
+    BusComplete();
+    BusComplete();
+    errors += Check((s_readings[1].count == 1U) && (s_readings[1].status == SENSOR_ERROR_READ) && (s_aborts == 1U),
+                    "NACK of B aborts and reports SENSOR_ERROR_READ");
+    errors += Check(!s_busBusy, "bus idle after the NACK");
+    s_nackAddress = 0U;
+
+    /* Edge A during a blocking read of B: refused, then started from the main loop. */
+    s_edgeDuringTransmit = s_edgeHandler[0];
+    s_edgeDuringTransmitData = s_edgeData[0];
+    errors += Check((P3T1085_I2C_GetTempQ4(&sensorB, &tempQ4) == SENSOR_ERROR_NONE) && (tempQ4 == TEST_TEMP_B_Q4),
+                    "blocking read of B");
+    errors += Check((s_readings[0].count == 1U) && !s_busBusy, "edge A held while the blocking read owns the bus");
+    P3T1085_Alert_Poll();
+    BusComplete();
+    BusComplete();
+    errors += Check((s_readings[0].count == 2U) && (s_readings[0].tempQ4 == TEST_TEMP_A_Q4),
+                    "edge A read from P3T1085_Alert_Poll()");
+
+    /* A blocking read of A waits for the asynchronous read of B, completed from its idle function. */
+    Edge(1U);
+    errors += Check((P3T1085_I2C_GetTempQ4(&sensorA, &tempQ4) == SENSOR_ERROR_NONE) && (tempQ4 == TEST_TEMP_A_Q4),
+                    "blocking read of A after the asynchronous read");
+    errors += Check((s_readings[1].count == 2U) && (s_readings[1].tempQ4 == TEST_TEMP_B_Q4),
+                    "asynchronous read of B completed first");
+
+    /* Alarm on the route of A: active high, T-High 28 C, no glitch window. */
+    errors += Check(P3T1085_Alarm_Init(&alarm, &alarmConfig, TEST_TEMP_A_Q4 + 80, 0U, NULL, NULL) ==
+                        SENSOR_ERROR_NONE,
+                    "alarm init");
+    errors += Check(P3T1085_Alert_AttachAlarm(&sensorA, &alarm) == SENSOR_ERROR_NONE, "alarm attached to A");
+    P3T1085_Alert_Poll();
+    GPIO_PinWrite(GPIO0, ALERT_PIN, 1U);
+    transmits = s_transmits;
+    Edge(0U);
+    errors += Check(s_transmits == transmits + 1U, "assertion edge reads A");
+    BusComplete();
+    BusComplete();
+    P3T1085_Alert_Poll();
+    errors += Check(alarm.state == P3T1085UK_ALARM_OVER, "alarm raised on the assertion edge");
+    GPIO_PinWrite(GPIO0, ALERT_PIN, 0U);
+    transmits = s_transmits;
+    Edge(0U);
+    errors += Check((s_transmits == transmits) && !s_busBusy, "release edge starts no read");
+    P3T1085_Alert_Poll();
+    errors += Check(alarm.state == P3T1085UK_ALARM_NORMAL, "alarm back to normal on the release edge");
+    errors += Check(s_pinReads == 0U, "ALERT_LED sampled through ALERT_PinRead()");
+    printf("router checks: %lu errors\n", errors);
+
+    /* CPU time of the interrupt path, every transfer completes at once. */
+    s_immediate = true;
+    GPIO_PinWrite(GPIO0, ALERT_PIN, 1U);
+    s_readings[0].count = 0U;
+    for (unsigned long n = 0U; n < iterations; n++)
+    {
+        Edge(0U);
+        latencySum += s_readings[0].latency;
+    }
+    errors += Check(s_readings[0].count == iterations, "one reading per edge");
+
+    start = MSDK_GetCpuCycleCount();
+    for (unsigned long n = 0U; n < iterations; n++)
+    {
+        (void)P3T1085_I2C_GetTempQ4(&sensorA, &tempQ4);
+    }
+    blockingNs = (double)(uint32_t)(MSDK_GetCpuCycleCount() - start) / (double)iterations;
+
+    printf("ALERT edge to reading: %.1f ns of CPU, blocking P3T1085_I2C_GetTempQ4(): %.1f ns, bus time excluded\n",
+           (double)latencySum / (double)iterations, blockingNs);
+
+    return (errors == 0U) ? 0 : 1;
+}
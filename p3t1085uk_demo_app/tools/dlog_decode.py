@@ -0,0 +1,223 @@
+#!/usr/bin/env python3
+#
+# Copyright 2024 NXP
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+"""Expand deferred log (DLOG) captures on the host.
+
+The firmware records each DLOG() call as a header word holding the argument
+count and the offset of its format string in the dlog_fmt section, followed by
+the raw 32-bit arguments (see utilities/deferred_log.h). This tool rebuilds the
+format table from the ELF image and renders the captured records as text.
+
+The capture may be a raw console log: each flush starts with the sync word, so
+the text around the records is skipped and the records are found at any byte
+offset.
+
+    dlog_decode.py table app.axf > dlog_fmt.json       (post-build step)
+    dlog_decode.py decode --table dlog_fmt.json capture.bin
+    dlog_decode.py decode --elf app.axf capture.bin
+"""
+
+import argparse
+import json
+import re
+import struct
+import sys
+
+DLOG_ID_MASK = 0x0FFFFFFF
+DLOG_NARGS_SHIFT = 28
+DLOG_MAX_ARGS = 8
+DLOG_SYNC_WORD = 0xFFFFFFFF
+DLOG_FMT_SYMBOL = "s_dlogFmt"
+DLOG_FMT_SECTION = "dlog_fmt"
+DLOG_SYNC_BYTES = struct.pack("<I", DLOG_SYNC_WORD)
+
+SHT_SYMTAB = 2
+SHT_NOBITS = 8
+STT_OBJECT = 1
+
+
+class Elf32:
+    """Minimal little-endian ELF32 reader: sections and the symbol table."""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        if self.data[:4] != b"\x7fELF" or self.data[4] != 1 or self.data[5] != 1:
+            raise ValueError("%s is not a little-endian ELF32 file" % path)
+        (shoff,) = struct.unpack_from("<I", self.data, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from("<HHH", self.data, 0x2E)
+        self.sections = []
+        for i in range(shnum):
+            fields = struct.unpack_from("<IIIIIIIIII", self.data, shoff + i * shentsize)
+            self.sections.append(
+                dict(zip(("name", "type", "flags", "addr", "offset", "size", "link", "info", "align", "entsize"), fields))
+            )
+        names = self.sections[shstrndx]["offset"]
+        for sec in self.sections:
+            start = names + sec["name"]
+            sec["name"] = self.data[start:self.data.index(b"\0", start)].decode("latin-1")
+
+    def section_index(self, name):
+        for i, sec in enumerate(self.sections):
+            if sec["name"] == name:
+                return i
+        return None
+
+    def read(self, addr, size):
+        for sec in self.sections:
+            if sec["type"] == SHT_NOBITS or sec["addr"] == 0 and sec["flags"] == 0:
+                continue
+            if sec["addr"] <= addr and addr + size <= sec["addr"] + sec["size"]:
+                start = sec["offset"] + addr - sec["addr"]
+                return self.data[start:start + size]
+        return None
+
+    def read_cstring(self, addr, limit=256):
+        for sec in self.sections:
+            if sec["type"] == SHT_NOBITS or sec["addr"] == 0 and sec["flags"] == 0:
+                continue
+            if sec["addr"] <= addr < sec["addr"] + sec["size"]:
+                start = sec["offset"] + addr - sec["addr"]
+                end = min(start + limit, sec["offset"] + sec["size"])
+                return self.data[start:end].split(b"\0", 1)[0].decode("latin-1")
+        return None
+
+    def symbols(self):
+        for sec in self.sections:
+            if sec["type"] != SHT_SYMTAB:
+                continue
+            strtab = self.sections[sec["link"]]
+            for off in range(sec["offset"], sec["offset"] + sec["size"], 16):
+                name, value, size, info, _, shndx = struct.unpack_from("<IIIBBH", self.data, off)
+                start = strtab["offset"] + name
+                sym = self.data[start:self.data.index(b"\0", start)].decode("latin-1")
+                yield sym, value, size, info & 0xF, shndx
+
+
+def extract_table(elf):
+    """Map format ID -> format string for every DLOG() call site in the image.
+
+    The ID is the offset of the string in the dlog_fmt section, as computed by
+    DLog_Write(), so it is unique whatever the load address of the image.
+    """
+    table = {}
+    index = elf.section_index(DLOG_FMT_SECTION)
+    if index is None:
+        return table
+    base = elf.sections[index]["addr"]
+    for name, value, size, stype, shndx in elf.symbols():
+        if stype != STT_OBJECT or shndx != index or not name.startswith(DLOG_FMT_SYMBOL) or size == 0:
+            continue
+        raw = elf.read(value, size)
+        if raw is not None:
+            table[value - base] = raw.split(b"\0", 1)[0].decode("latin-1")
+    return table
+
+
+SPEC = re.compile(r"%([-+ 0#]*)(\d*)(?:\.(\d+))?(?:hh|h|ll|l|z)?([diuxXocpsT%])")
+
+
+def to_signed(word):
+    return word - (1 << 32) if word & 0x80000000 else word
+
+
+def render(fmt, args, elf=None):
+    """printf subset matching the firmware's 32-bit argument capture."""
+    args = list(args)
+
+    def next_arg():
+        return args.pop(0) if args else 0
+
+    def convert(m):
+        flags, width, prec, conv = m.group(1), m.group(2), m.group(3), m.group(4)
+        if conv == "%":
+            return "%"
+        spec = "%" + flags + width + ("." + prec if prec is not None else "")
+        word = next_arg()
+        if conv in "di":
+            return (spec + "d") % to_signed(word)
+        if conv in "uxXo":
+            return (spec + conv) % word
+        if conv == "c":
+            return (spec + "c") % chr(word & 0xFF)
+        if conv == "p":
+            return "0x%08x" % word
+        if conv == "s":
+            text = elf.read_cstring(word) if elf is not None else None
+            return (spec + "s") % (text if text is not None else "<0x%08x>" % word)
+        if conv == "T":
+            digits = int(prec) if prec is not None else 6
+            return ("%" + flags + width + "." + str(digits) + "f") % (to_signed(word) / 16.0)
+        return m.group(0)
+
+    return SPEC.sub(convert, fmt)
+
+
+def decode_flush(stream, pos, table, elf, out):
+    """Render the records of one flush, pos is just after its sync word.
+
+    The flush has no length, it ends at the first word which is not a known
+    record: the console text printed after it, or the next sync word. Returns
+    the offset of that word.
+    """
+    if pos + 4 > len(stream):
+        return len(stream)
+    (dropped,) = struct.unpack_from("<I", stream, pos)
+    pos += 4
+    if dropped != 0:
+        out.write("<dlog: %d records dropped>\n" % dropped)
+    while pos + 4 <= len(stream):
+        (word,) = struct.unpack_from("<I", stream, pos)
+        nargs = word >> DLOG_NARGS_SHIFT
+        fmt = table.get(word & DLOG_ID_MASK)
+        if nargs > DLOG_MAX_ARGS or fmt is None or pos + 4 * (1 + nargs) > len(stream):
+            break
+        args = struct.unpack_from("<%dI" % nargs, stream, pos + 4)
+        pos += 4 * (1 + nargs)
+        out.write(render(fmt, args, elf).replace("\r\n", "\n"))
+    return pos
+
+
+def decode(stream, table, elf=None, out=sys.stdout):
+    """Scan the capture byte by byte for sync words and render each flush."""
+    pos = stream.find(DLOG_SYNC_BYTES)
+    while pos >= 0:
+        pos = decode_flush(stream, pos + 4, table, elf, out)
+        pos = stream.find(DLOG_SYNC_BYTES, pos)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = parser.add_subparsers(dest="cmd", required=True)
+    p_table = sub.add_parser("table", help="extract the format table from an ELF image")
+    p_table.add_argument("elf")
+    p_decode = sub.add_parser("decode", help="expand a raw capture")
+    p_decode.add_argument("capture")
+    src = p_decode.add_mutually_exclusive_group(required=True)
+    src.add_argument("--elf", help="ELF image the capture was produced by")
+    src.add_argument("--table", help="format table written by the table command")
+    opts = parser.parse_args()
+
+    if opts.cmd == "table":
+        table = extract_table(Elf32(opts.elf))
+        json.dump({"0x%07x" % k: v for k, v in sorted(table.items())}, sys.stdout, indent=1)
+        sys.stdout.write("\n")
+        return 0
+
+    elf = None
+    if opts.elf:
+        elf = Elf32(opts.elf)
+        table = extract_table(elf)
+    else:
+        with open(opts.table) as f:
+            table = {int(k, 16): v for k, v in json.load(f).items()}
+    with open(opts.capture, "rb") as f:
+        decode(f.read(), table, elf)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
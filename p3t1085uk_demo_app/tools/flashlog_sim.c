@@ -0,0 +1,386 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host flash simulator for the P3T1085UK log-structured flash store (sensors/p3t1085uk_flashlog.h).
+ *
+ * The simulated NOR flash has the geometry of the MCXN947 PROGRAM_FLASH1 bank by default. A
+ * program can only clear bits and only once per page between erases, an erase sets a sector to
+ * 0xFF. Power cuts are injected at random flash operations: the program or erase in progress is
+ * torn, every later operation fails until the store is mounted again. A torn page fails its
+ * reads, like the ECC error of the MCXN947 flash, and its blank check even when it reads as
+ * erased. After each mount the records are read back and checked:
+ *   - every record is intact, its time and payload match its sequence number,
+ *   - the sequence numbers follow without gap up to the newest acknowledged record,
+ *     at most one record past it, the one being written at the cut,
+ *   - P3T1085_FlashLog_Find() returns the newest record at or before random times,
+ *   - no page is programmed twice.
+ * With --blank 1, the default, the region has a blank function and the appends go on in the
+ * sector written before the mount, with --blank 0 every mount after an append opens a new sector.
+ * Then throughput, write amplification and wear spread of an uninterrupted run are reported.
+ *
+ * Build and run from this directory:
+ *   gcc -O2 -Wall -I../frdmmcxn947/frdmmcxn947_p3t1085uk_example/sensors \
+ *       -I../frdmmcxn947/frdmmcxn947_p3t1085uk_example/interfaces -o flashlog_sim flashlog_sim.c \
+ *       ../frdmmcxn947/frdmmcxn947_p3t1085uk_example/sensors/p3t1085uk_flashlog.c \
+ *       ../frdmmcxn947/frdmmcxn947_p3t1085uk_example/sensors/p3t1085uk_crc.c
+ *   ./flashlog_sim [--records N] [--cuts N] [--seed N] [--payload N] [--sector-size N] [--page-size N]
+ *                  [--size N] [--program-us N] [--erase-us N] [--blank 0|1]
+ * The program and erase times only scale the throughput figures, set them from the device data sheet.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sensor_drv.h"
+#include "p3t1085uk_flashlog.h"
+
+#define SIM_BASE       (0x100000U)
+#define SIM_RECORD_MS  (60000U)
+#define SIM_TORN       (2U)
+
+typedef struct
+{
+    uint8_t *pMemory;
+    uint8_t *pProgrammed; /* Page programmed since its sector was erased, SIM_TORN when cut. */
+    p3t1085_flash_t flash;
+    long cutIn;           /* Operations left before the power cut, negative for none. */
+    int cut;
+    unsigned long programs;
+    unsigned long erases;
+    unsigned long reads;
+    unsigned long violations;
+} sim_t;
+
+static uint32_t gRandom = 1U;
+
+static uint32_t Random(void)
+{
+    gRandom ^= gRandom << 13;
+    gRandom ^= gRandom >> 17;
+    gRandom ^= gRandom << 5;
+    return gRandom;
+}
+
+static int Cut(sim_t *pSim)
+{
+    if (pSim->cut)
+    {
+        return 1;
+    }
+    if ((pSim->cutIn >= 0) && (pSim->cutIn-- == 0))
+    {
+        pSim->cut = 1;
+        return 2;
+    }
+    return 0;
+}
+
+static int32_t SimErase(void *pContext, uint32_t address)
+{
+    sim_t *pSim = pContext;
+    uint32_t offset = address - pSim->flash.base;
+    uint32_t size = pSim->flash.sectorSize;
+    int cut = Cut(pSim);
+
+    if (cut == 1)
+    {
+        return SENSOR_ERROR_WRITE;
+    }
+    if ((offset % size) != 0U)
+    {
+        pSim->violations++;
+        return SENSOR_ERROR_BAD_ADDRESS;
+    }
+    pSim->erases++;
+    if (cut == 2)
+    {
+        /* Torn erase: a random part of the sector is erased, the rest keeps its bits. */
+        for (uint32_t i = 0; i < size; i++)
+        {
+            if (Random() & 1U)
+            {
+                pSim->pMemory[offset + i] = 0xFFU;
+            }
+        }
+        memset(&pSim->pProgrammed[offset / pSim->flash.pageSize], SIM_TORN, size / pSim->flash.pageSize);
+        return SENSOR_ERROR_WRITE;
+    }
+    memset(&pSim->pMemory[offset], 0xFF, size);
+    memset(&pSim->pProgrammed[offset / pSim->flash.pageSize], 0, size / pSim->flash.pageSize);
+    return SENSOR_ERROR_NONE;
+}
+
+static int32_t SimProgram(void *pContext, uint32_t address, const uint8_t *pData)
+{
+    sim_t *pSim = pContext;
+    uint32_t offset = address - pSim->flash.base;
+    uint32_t size = pSim->flash.pageSize;
+    uint32_t torn = size;
+    int cut = Cut(pSim);
+
+    if (cut == 1)
+    {
+        return SENSOR_ERROR_WRITE;
+    }
+    if (((offset % size) != 0U) || pSim->pProgrammed[offset / size])
+    {
+        pSim->violations++;
+        return SENSOR_ERROR_WRITE;
+    }
+    pSim->programs++;
+    pSim->pProgrammed[offset / size] = 1U;
+    if (cut == 2)
+    {
+        pSim->pProgrammed[offset / size] = SIM_TORN;
+        /* Torn program: a random prefix is programmed, the next byte only partly. */
+        torn = Random() % (size + 1U);
+        if (torn < size)
+        {
+            pSim->pMemory[offset + torn] &= (uint8_t)(pData[torn] | Random());
+        }
+    }
+    for (uint32_t i = 0; i < torn; i++)
+    {
+        pSim->pMemory[offset + i] &= pData[i];
+    }
+    return (cut == 2) ? SENSOR_ERROR_WRITE : SENSOR_ERROR_NONE;
+}
+
+static int32_t SimRead(void *pContext, uint32_t address, uint8_t *pData, uint32_t size)
+{
+    sim_t *pSim = pContext;
+    uint32_t offset = address - pSim->flash.base;
+
+    pSim->reads++;
+    for (uint32_t page = offset / pSim->flash.pageSize; page <= (offset + size - 1U) / pSim->flash.pageSize; page++)
+    {
+        if (pSim->pProgrammed[page] == SIM_TORN)
+        {
+            return SENSOR_ERROR_READ;
+        }
+    }
+    memcpy(pData, &pSim->pMemory[offset], size);
+    return SENSOR_ERROR_NONE;
+}
+
+/* Only a page untouched since its sector erase passes, a page torn at the start of its program
+ * reads as erased but fails. */
+static int32_t SimBlank(void *pContext, uint32_t address)
+{
+    sim_t *pSim = pContext;
+    uint32_t offset = address - pSim->flash.base;
+
+    pSim->reads++;
+    return (pSim->pProgrammed[offset / pSim->flash.pageSize] == 0U) ? SENSOR_ERROR_NONE : SENSOR_ERROR_READ;
+}
+
+/* Time and payload are functions of the record sequence number. */
+static uint32_t RecordTime(uint32_t seq)
+{
+    return 0xFFFF0000U + seq * SIM_RECORD_MS;
+}
+
+static void RecordPayload(uint32_t seq, uint8_t *pData, uint16_t length)
+{
+    uint32_t x = seq * 2654435761U;
+
+    for (uint16_t i = 0; i < length; i++)
+    {
+        x = x * 1103515245U + 12345U;
+        pData[i] = (uint8_t)(x >> 24);
+    }
+}
+
+/* Read the whole store back, returns the number of errors. */
+static unsigned long Check(const p3t1085_flashlog_t *pLog, uint16_t payload, uint32_t lastAck, uint32_t *pNewest)
+{
+    uint8_t data[P3T1085_FLASHLOG_MAX_PAGE_SIZE];
+    uint8_t expected[P3T1085_FLASHLOG_MAX_PAGE_SIZE];
+    p3t1085_flashlog_record_t record;
+    uint32_t address = P3T1085_FLASHLOG_OLDEST;
+    uint32_t first = 0U;
+    uint32_t last = 0U;
+    uint32_t found;
+    uint32_t timeMs;
+    unsigned long errors = 0;
+
+    while (SENSOR_ERROR_NONE == P3T1085_FlashLog_Read(pLog, &address, &record, data))
+    {
+        RecordPayload(record.seq, expected, payload);
+        if ((record.length != payload) || (record.timeMs != RecordTime(record.seq)) ||
+            memcmp(data, expected, payload))
+        {
+            printf("record %u corrupted\n", record.seq);
+            errors++;
+        }
+        if ((last != 0U) && (record.seq != last + 1U))
+        {
+            printf("record %u follows %u\n", record.seq, last);
+            errors++;
+        }
+        first = (first == 0U) ? record.seq : first;
+        last = record.seq;
+        address++;
+    }
+    if ((last < lastAck) || (last > lastAck + 1U))
+    {
+        printf("newest record %u, %u acknowledged\n", last, lastAck);
+        errors++;
+    }
+    if ((last != 0U) && (pLog->lastTimeMs != RecordTime(last)))
+    {
+        printf("newest time %u, record %u\n", pLog->lastTimeMs, last);
+        errors++;
+    }
+
+    for (int i = 0; (i < 16) && (last != 0U); i++)
+    {
+        uint32_t seq = first + Random() % (last - first + 1U);
+        timeMs = RecordTime(seq) + Random() % SIM_RECORD_MS;
+        if ((SENSOR_ERROR_NONE != P3T1085_FlashLog_Find(pLog, timeMs, &found)) ||
+            (SENSOR_ERROR_NONE != P3T1085_FlashLog_Read(pLog, &found, &record, NULL)) || (record.seq != seq))
+        {
+            printf("find %u failed\n", seq);
+            errors++;
+        }
+    }
+    if ((last != 0U) && (SENSOR_ERROR_NONE == P3T1085_FlashLog_Find(pLog, RecordTime(first) - 1U, &found)))
+    {
+        printf("find before the oldest record succeeded\n");
+        errors++;
+    }
+
+    *pNewest = last;
+    return errors;
+}
+
+static unsigned long ArgValue(int argc, char **argv, const char *pName, unsigned long value)
+{
+    for (int i = 1; i + 1 < argc; i++)
+    {
+        if (strcmp(argv[i], pName) == 0)
+        {
+            return strtoul(argv[i + 1], NULL, 0);
+        }
+    }
+    return value;
+}
+
+int main(int argc, char **argv)
+{
+    static p3t1085_flashlog_t log;
+    uint8_t data[P3T1085_FLASHLOG_MAX_PAGE_SIZE];
+    sim_t sim;
+    unsigned long records = ArgValue(argc, argv, "--records", 200000UL);
+    unsigned long cuts = ArgValue(argc, argv, "--cuts", 2000UL);
+    unsigned long programUs = ArgValue(argc, argv, "--program-us", 100UL);
+    unsigned long eraseUs = ArgValue(argc, argv, "--erase-us", 5000UL);
+    uint16_t payload = (uint16_t)ArgValue(argc, argv, "--payload", 112UL);
+    unsigned long errors = 0;
+    unsigned long mountReads = 0;
+    unsigned long cutErases = 0;
+    uint32_t lastAck = 0U;
+    uint32_t minErase = 0xFFFFFFFFU;
+    uint32_t maxErase = 0U;
+
+    gRandom = (uint32_t)ArgValue(argc, argv, "--seed", 1UL) * 2U + 1U;
+    memset(&sim, 0, sizeof(sim));
+    sim.flash.erase = SimErase;
+    sim.flash.program = SimProgram;
+    sim.flash.read = SimRead;
+    sim.flash.blank = (ArgValue(argc, argv, "--blank", 1UL) != 0UL) ? SimBlank : NULL;
+    sim.flash.pContext = &sim;
+    sim.flash.base = SIM_BASE;
+    sim.flash.size = (uint32_t)ArgValue(argc, argv, "--size", 0x100000UL);
+    sim.flash.sectorSize = (uint32_t)ArgValue(argc, argv, "--sector-size", 8192UL);
+    sim.flash.pageSize = (uint32_t)ArgValue(argc, argv, "--page-size", 128UL);
+    sim.pMemory = malloc(sim.flash.size);
+    sim.pProgrammed = calloc(sim.flash.size / sim.flash.pageSize, 1);
+    if ((sim.pMemory == NULL) || (sim.pProgrammed == NULL) ||
+        (payload > sim.flash.pageSize - P3T1085_FLASHLOG_HEADER_SIZE))
+    {
+        printf("bad arguments\n");
+        return 1;
+    }
+    memset(sim.pMemory, 0xFF, sim.flash.size);
+    sim.cutIn = -1;
+    if (SENSOR_ERROR_NONE != P3T1085_FlashLog_Mount(&log, &sim.flash))
+    {
+        printf("mount failed\n");
+        return 1;
+    }
+
+    /* Crash consistency: append until a random operation cuts the power, mount and check. */
+    for (unsigned long cut = 0; cut < cuts; cut++)
+    {
+        sim.cut = 0;
+        sim.cutIn = (long)(Random() % (2U * (sim.flash.sectorSize / sim.flash.pageSize)));
+        while (!sim.cut)
+        {
+            uint32_t seq = log.recordSeq;
+
+            RecordPayload(seq, data, payload);
+            if (SENSOR_ERROR_NONE == P3T1085_FlashLog_Append(&log, RecordTime(seq), data, payload))
+            {
+                lastAck = seq;
+            }
+        }
+        sim.cut = 0;
+        sim.cutIn = -1;
+        sim.reads = 0;
+        if (SENSOR_ERROR_NONE != P3T1085_FlashLog_Mount(&log, &sim.flash))
+        {
+            printf("mount failed\n");
+            return 1;
+        }
+        mountReads = sim.reads;
+        errors += Check(&log, payload, lastAck, &lastAck);
+    }
+    cutErases = sim.erases;
+    printf("%lu power cuts, newest record %u, %lu errors, %lu double programs, %lu page reads per mount\n", cuts,
+           lastAck, errors, sim.violations, mountReads);
+    printf("%lu erases, %.2f per power cut, blank function %s\n", cutErases, (double)cutErases / (double)cuts,
+           (sim.flash.blank != NULL) ? "on" : "off");
+
+    /* Throughput and wear of an uninterrupted run. */
+    sim.programs = 0;
+    sim.erases = 0;
+    for (unsigned long i = 0; i < records; i++)
+    {
+        uint32_t seq = log.recordSeq;
+
+        RecordPayload(seq, data, payload);
+        if (SENSOR_ERROR_NONE != P3T1085_FlashLog_Append(&log, RecordTime(seq), data, payload))
+        {
+            printf("append %u failed\n", seq);
+            errors++;
+        }
+        lastAck = seq;
+    }
+    sim.reads = 0;
+    errors += Check(&log, payload, lastAck, &lastAck);
+    for (uint32_t i = 0; i < log.sectorCount; i++)
+    {
+        minErase = (log.sectors[i].eraseCount < minErase) ? log.sectors[i].eraseCount : minErase;
+        maxErase = (log.sectors[i].eraseCount > maxErase) ? log.sectors[i].eraseCount : maxErase;
+    }
+    printf("%lu records: %lu programs, %lu erases, %.3f programs per record\n", records, sim.programs, sim.erases,
+           (double)sim.programs / (double)records);
+    printf("write amplification %.2f (flash bytes per payload byte), erase counts %u..%u\n",
+           (double)(sim.programs * sim.flash.pageSize) / ((double)records * payload), minErase, maxErase);
+    printf("%.1f us per record at %lu us per program and %lu us per erase, %.0f records/s\n",
+           (double)(sim.programs * programUs + sim.erases * eraseUs) / (double)records, programUs, eraseUs,
+           1e6 * (double)records / (double)(sim.programs * programUs + sim.erases * eraseUs));
+    printf("capacity %u records, %u days at one record per minute per 100k erase cycles\n",
+           (log.sectorCount - 1U) * (log.pagesPerSector - 1U),
+           (uint32_t)(100000.0 * log.sectorCount * (log.pagesPerSector - 1U) / 1440.0));
+
+    free(sim.pMemory);
+    free(sim.pProgrammed);
+    return (errors != 0UL) || (sim.violations != 0UL);
+}
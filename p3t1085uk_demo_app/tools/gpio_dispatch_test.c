@@ -0,0 +1,228 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host check and benchmark of the GPIO interrupt dispatcher of gpio_driver/gpio_driver.c.
+ *
+ * The driver and GPIO00_IRQHandler() of gpio_driver_irq.c are built against the host GPIO port
+ * of host/fsl_gpio.h. The checks:
+ *   - pending pins are dispatched by priority level, then from the highest pin number down,
+ *   - the serviced flags are acknowledged with one write before the handlers run, so an edge
+ *     raised again by a handler stays pending, and pins without a handler stay pending,
+ *   - with GPIO_DISPATCH_PROFILE=1, the statistics count the handler calls.
+ * Then the time per interrupt of GPIO00_IRQHandler() is compared with the loop of the previous
+ * driver, which tested the 32 pins and cleared each serviced flag after its handler, for one
+ * pending pin among 3 and 32 installed handlers. The host clock is the cycle counter, so the
+ * profile latency is in nanoseconds. The profile reads the clock twice per interrupt, which
+ * costs more than the dispatch on the host: time the dispatcher with GPIO_DISPATCH_PROFILE=0.
+ *
+ * Build and run from this directory:
+ *   gcc -O2 -Wall -DGPIO_DISPATCH_PROFILE=0 -Ihost \
+ *       -I../frdmmcxn947/frdmmcxn947_p3t1085uk_example/gpio_driver \
+ *       -I../frdmmcxn947/frdmmcxn947_p3t1085uk_example/CMSIS_driver/Include -o gpio_dispatch_test \
+ *       gpio_dispatch_test.c ../frdmmcxn947/frdmmcxn947_p3t1085uk_example/gpio_driver/gpio_driver.c \
+ *       ../frdmmcxn947/frdmmcxn947_p3t1085uk_example/gpio_driver/gpio_driver_irq.c
+ *   ./gpio_dispatch_test [--iterations N]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gpio_driver.h"
+
+#define TEST_PIN_COUNT (32U)
+#define TEST_MAX_CALLS (64U)
+
+void GPIO00_IRQHandler(void);
+
+GPIO_Type g_hostGpio0;
+
+static gpioHandleKSDK_t s_pins[TEST_PIN_COUNT];
+static gpioIsrObj_t s_baselineIsr[TEST_PIN_COUNT];
+static uint32_t s_calls[TEST_MAX_CALLS];
+static uint32_t s_callCount;
+static uint32_t s_repend;
+static uint32_t s_flagsSeen;
+static volatile uint32_t s_sink;
+
+static void PinHandler(void *pUserData)
+{
+    uint32_t pin = (uint32_t)(uintptr_t)pUserData;
+
+    if (s_callCount < TEST_MAX_CALLS)
+    {
+        s_calls[s_callCount] = pin;
+    }
+    s_callCount++;
+    s_flagsSeen |= GPIO0->ISFR[0] & (1UL << pin);
+    if ((s_repend & (1UL << pin)) != 0U)
+    {
+        GPIO0->ISFR[0] |= 1UL << pin;
+        s_repend &= ~(1UL << pin);
+    }
+}
+
+static void BenchHandler(void *pUserData)
+{
+    s_sink += (uint32_t)(uintptr_t)pUserData;
+}
+
+/* The loop of the previous driver: every pin is tested, each flag is cleared after its handler. */
+__attribute__((noinline)) static void BaselineDispatch(GPIO_Type *apBase)
+{
+    uint32_t isfr = GPIO_GpioGetInterruptFlags(apBase);
+
+    for (uint8_t i = 0; i < TEST_PIN_COUNT; i++)
+    {
+        if (isfr & (1UL << i))
+        {
+            gpio_isr_handler_t handle = s_baselineIsr[i].isrHandle;
+            if (handle == NULL)
+            {
+                continue;
+            }
+            handle(s_baselineIsr[i].pUserData);
+            GPIO_PinClearInterruptFlag(apBase, i);
+        }
+    }
+}
+
+static void InstallPin(uint32_t pin, gpio_isr_handler_t handler)
+{
+    s_pins[pin] = (gpioHandleKSDK_t){.base = GPIO0,
+                                     .pinNumber = pin,
+                                     .mask = 1UL << pin,
+                                     .irq = 0,
+                                     .clockName = 0,
+                                     .portNumber = PORTA_NUM};
+    Driver_GPIO_KSDK.pin_init(&s_pins[pin], GPIO_DIRECTION_IN, NULL, handler, (void *)(uintptr_t)pin);
+    s_baselineIsr[pin].isrHandle = handler;
+    s_baselineIsr[pin].pUserData = (void *)(uintptr_t)pin;
+}
+
+static double BenchDriver(unsigned long iterations, uint32_t pin)
+{
+    uint32_t start = MSDK_GetCpuCycleCount();
+
+    for (unsigned long n = 0U; n < iterations; n++)
+    {
+        GPIO0->ISFR[0] = 1UL << pin;
+        GPIO00_IRQHandler();
+    }
+    return (double)(uint32_t)(MSDK_GetCpuCycleCount() - start) / (double)iterations;
+}
+
+static double BenchBaseline(unsigned long iterations, uint32_t pin)
+{
+    uint32_t start = MSDK_GetCpuCycleCount();
+
+    for (unsigned long n = 0U; n < iterations; n++)
+    {
+        GPIO0->ISFR[0] = 1UL << pin;
+        BaselineDispatch(GPIO0);
+    }
+    return (double)(uint32_t)(MSDK_GetCpuCycleCount() - start) / (double)iterations;
+}
+
+int main(int argc, char *argv[])
+{
+    const uint32_t cExpected[] = {1U, 28U, 5U};
+    unsigned long iterations = 2000000U;
+    unsigned long errors = 0U;
+#if (GPIO_DISPATCH_PROFILE > 0)
+    gpioDispatchStats_t stats;
+#endif
+    double driverNs;
+    double baselineNs;
+    int i;
+
+    for (i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--iterations") == 0) && (i + 1 < argc))
+        {
+            iterations = strtoul(argv[++i], NULL, 0);
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [--iterations N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    /* Pins 1, 5 and 28 have handlers, pin 1 at the top level, pin 9 is pending without one. */
+    InstallPin(1U, PinHandler);
+    InstallPin(5U, PinHandler);
+    InstallPin(28U, PinHandler);
+    ksdk_gpio_set_pin_priority(&s_pins[1], GPIO_ISR_PRIORITY_LEVELS - 1);
+#if (GPIO_DISPATCH_PROFILE > 0)
+    ksdk_gpio_get_dispatch_stats(&stats);
+#endif
+
+    GPIO0->ISFR[0] = (1UL << 1) | (1UL << 5) | (1UL << 9) | (1UL << 28);
+    GPIO0->clearWrites = 0U;
+    s_repend = 1UL << 5;
+    GPIO00_IRQHandler();
+
+    if ((s_callCount != 3U) || (memcmp(s_calls, cExpected, sizeof(cExpected)) != 0))
+    {
+        errors++;
+        printf("dispatch order: %u calls, %u %u %u, expected 1 28 5\n", s_callCount, s_calls[0], s_calls[1],
+               s_calls[2]);
+    }
+    if ((GPIO0->clearWrites != 1U) || (s_flagsSeen != 0U))
+    {
+        errors++;
+        printf("acknowledge: %u writes, flags 0x%08x seen by the handlers, expected one write before them\n",
+               GPIO0->clearWrites, s_flagsSeen);
+    }
+    if (GPIO0->ISFR[0] != ((1UL << 5) | (1UL << 9)))
+    {
+        errors++;
+        printf("pending after dispatch 0x%08x, expected the re-raised pin 5 and pin 9\n", GPIO0->ISFR[0]);
+    }
+#if (GPIO_DISPATCH_PROFILE > 0)
+    ksdk_gpio_get_dispatch_stats(&stats);
+    if (stats.dispatchCount != 3U)
+    {
+        errors++;
+        printf("profile: %u dispatches counted, expected 3\n", stats.dispatchCount);
+    }
+#endif
+
+    /* The re-raised edge is served by the next interrupt. */
+    s_callCount = 0U;
+    GPIO00_IRQHandler();
+    if ((s_callCount != 1U) || (s_calls[0] != 5U) || (GPIO0->ISFR[0] != (1UL << 9)))
+    {
+        errors++;
+        printf("re-raised edge: %u calls, pending 0x%08x\n", s_callCount, GPIO0->ISFR[0]);
+    }
+    printf("dispatch checks: %lu errors\n", errors);
+
+    /* One pending pin, the ALERT pin 28, with the 3 handlers of the checks and then with 32. */
+    for (uint32_t installed = 3U; installed <= TEST_PIN_COUNT; installed += TEST_PIN_COUNT - 3U)
+    {
+        for (uint32_t pin = 0U; pin < TEST_PIN_COUNT; pin++)
+        {
+            if ((pin == 28U) || (installed == TEST_PIN_COUNT))
+            {
+                InstallPin(pin, BenchHandler);
+            }
+        }
+        driverNs = BenchDriver(iterations, 28U);
+        baselineNs = BenchBaseline(iterations, 28U);
+        printf("%2u handlers, pin 28 pending: dispatcher %.1f ns, previous loop %.1f ns per interrupt\n", installed,
+               driverNs, baselineNs);
+#if (GPIO_DISPATCH_PROFILE > 0)
+        ksdk_gpio_get_dispatch_stats(&stats);
+        printf("   dispatcher entry to handler call: last %u ns, max %u ns\n", stats.lastLatencyCycles,
+               stats.maxLatencyCycles);
+#endif
+    }
+
+    return (errors == 0U) ? 0 : 1;
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host stand-in for the MCUXpresso SDK fsl_common.h, for the host tools of this directory.
+ *
+ * It only provides what the sources built by the tools use from the SDK header and the CMSIS
+ * core, so they compile unchanged with gcc or clang on the host. Interrupt masking does nothing,
+ * the tools call the handlers themselves. __DMB() is a full fence, so code shared between
+ * threads keeps its ordering on the host. The CPU cycle counter counts nanoseconds of the host
+ * monotonic clock.
+ */
+
+#ifndef FSL_COMMON_H_
+#define FSL_COMMON_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#ifndef MIN
+#define MIN(a, b) (((a) < (b)) ? (a) : (b))
+#endif
+#ifndef MAX
+#define MAX(a, b) (((a) > (b)) ? (a) : (b))
+#endif
+#ifndef ARRAY_SIZE
+#define ARRAY_SIZE(x) (sizeof(x) / sizeof((x)[0]))
+#endif
+
+typedef int32_t status_t;
+enum
+{
+    kStatus_Success = 0,
+    kStatus_Fail    = 1,
+};
+
+typedef int IRQn_Type;
+typedef int clock_ip_name_t;
+
+#define SDK_ISR_EXIT_BARRIER
+#define __NOP()
+#define __DMB() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+static inline uint32_t __CLZ(uint32_t value)
+{
+    return (value == 0U) ? 32U : (uint32_t)__builtin_clz(value);
+}
+
+static inline uint32_t DisableGlobalIRQ(void)
+{
+    return 0U;
+}
+
+static inline void EnableGlobalIRQ(uint32_t primask)
+{
+    (void)primask;
+}
+
+static inline void EnableIRQ(IRQn_Type interrupt)
+{
+    (void)interrupt;
+}
+
+static inline void CLOCK_EnableClock(clock_ip_name_t name)
+{
+    (void)name;
+}
+
+static inline void MSDK_EnableCpuCycleCounter(void)
+{
+}
+
+static inline uint32_t MSDK_GetCpuCycleCount(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)((uint64_t)now.tv_sec * 1000000000U + (uint64_t)now.tv_nsec);
+}
+
+#endif /* FSL_COMMON_H_ */
@@ -0,0 +1,105 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host stand-in for the MCUXpresso SDK fsl_gpio.h, for the host tools of this directory.
+ *
+ * A GPIO port is a plain structure: the tool sets pin flags in ISFR[0] and the pin levels in
+ * PDIR to simulate edges, and reads back the acknowledge writes counted in clearWrites.
+ * GPIO0 is defined by the tool.
+ */
+
+#ifndef FSL_GPIO_H_
+#define FSL_GPIO_H_
+
+#include "fsl_common.h"
+
+typedef struct
+{
+    uint32_t PDIR;        /* Pin levels. */
+    uint32_t ISFR[2];     /* Interrupt flags, pin n is bit n of ISFR[0]. */
+    uint32_t ICR[32];     /* Last interrupt configuration of each pin. */
+    uint32_t clearWrites; /* Number of GPIO_GpioClearInterruptFlags() calls. */
+} GPIO_Type;
+
+extern GPIO_Type g_hostGpio0;
+#define GPIO0 (&g_hostGpio0)
+
+typedef enum
+{
+    kGPIO_DigitalInput  = 0U,
+    kGPIO_DigitalOutput = 1U,
+} gpio_pin_direction_t;
+
+typedef struct
+{
+    gpio_pin_direction_t pinDirection;
+    uint8_t outputLogic;
+} gpio_pin_config_t;
+
+typedef enum
+{
+    kGPIO_InterruptStatusFlagDisabled = 0x0U,
+    kGPIO_InterruptRisingEdge         = 0x9U,
+    kGPIO_InterruptFallingEdge        = 0xAU,
+    kGPIO_InterruptEitherEdge         = 0xBU,
+} gpio_interrupt_config_t;
+
+static inline void GPIO_PinInit(GPIO_Type *base, uint32_t pin, const gpio_pin_config_t *config)
+{
+    (void)base;
+    (void)pin;
+    (void)config;
+}
+
+static inline uint32_t GPIO_PinRead(GPIO_Type *base, uint32_t pin)
+{
+    return (base->PDIR >> pin) & 1U;
+}
+
+static inline void GPIO_PinWrite(GPIO_Type *base, uint32_t pin, uint8_t output)
+{
+    base->PDIR = (base->PDIR & ~(1UL << pin)) | ((uint32_t)(output != 0U) << pin);
+}
+
+static inline void GPIO_PortSet(GPIO_Type *base, uint32_t mask)
+{
+    base->PDIR |= mask;
+}
+
+static inline void GPIO_PortClear(GPIO_Type *base, uint32_t mask)
+{
+    base->PDIR &= ~mask;
+}
+
+static inline void GPIO_PortToggle(GPIO_Type *base, uint32_t mask)
+{
+    base->PDIR ^= mask;
+}
+
+static inline void GPIO_SetPinInterruptConfig(GPIO_Type *base, uint32_t pin, gpio_interrupt_config_t config)
+{
+    base->ICR[pin] = (uint32_t)config;
+}
+
+static inline uint32_t GPIO_GpioGetInterruptFlags(GPIO_Type *base)
+{
+    return base->ISFR[0];
+}
+
+static inline void GPIO_GpioClearInterruptFlags(GPIO_Type *base, uint32_t mask)
+{
+    base->ISFR[0] &= ~mask;
+    base->clearWrites++;
+}
+
+static inline void GPIO_PinClearInterruptFlag(GPIO_Type *base, uint32_t pin)
+{
+    base->ISFR[0] &= ~(1UL << pin);
+    base->clearWrites++;
+}
+
+#endif /* FSL_GPIO_H_ */
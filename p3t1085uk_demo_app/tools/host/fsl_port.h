@@ -0,0 +1,34 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host stand-in for the MCUXpresso SDK fsl_port.h, for the host tools of this directory.
+ * Only the types the gpio driver stores are defined, the pin mux has no effect on the host.
+ */
+
+#ifndef FSL_PORT_H_
+#define FSL_PORT_H_
+
+#include "fsl_common.h"
+
+typedef struct
+{
+    uint32_t PCR[32];
+} PORT_Type;
+
+enum
+{
+    kPORT_MuxAsGpio = 0U,
+    kPORT_PullUp    = 3U,
+};
+
+typedef struct
+{
+    uint16_t pullSelect;
+    uint16_t mux;
+} port_pin_config_t;
+
+#endif /* FSL_PORT_H_ */
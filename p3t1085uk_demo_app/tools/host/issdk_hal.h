@@ -0,0 +1,49 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host stand-in for the board issdk_hal.h, for the host tools of this directory.
+ *
+ * It describes three LPI2C instances, as register_io_i2c.c expects on FRDM-MCXN947, so the
+ * I2C2_SignalEvent_t() handler of the shield bus is built. The instances have no registers,
+ * the tools drive the bus through a mock CMSIS I2C driver. ARM_I2C_SUBADDRESS is not defined:
+ * blocking writes send the register offset in the data, as with the SDK CMSIS drivers.
+ * The board ALERT pin is pin 28 of the host GPIO0 port, its level is bit 28 of PDIR, and
+ * ALERT_LED is defined by the tool.
+ */
+
+#ifndef __ISSDK_HAL_H__
+#define __ISSDK_HAL_H__
+
+#include "fsl_common.h"
+#include "Driver_I2C.h"
+#include "gpio_driver.h"
+
+#define CPU_MCXN947VDF_cm33_core0
+
+typedef struct
+{
+    uint32_t reserved;
+} LPI2C_Type;
+
+extern LPI2C_Type g_hostLpi2c[3];
+#define LPI2C_BASE_PTRS {&g_hostLpi2c[0], &g_hostLpi2c[1], &g_hostLpi2c[2]}
+#define I2C2            (&g_hostLpi2c[2])
+
+#define I2C_S_DEVICE_INDEX 2U
+
+// Defined by the FRDM-STBI-P1085 shield header on the boards.
+#define SENSOR_MAX_WRITE_BYTES 2
+
+extern gpioHandleKSDK_t ALERT_LED;
+#define ALERT_GPIO        GPIO0
+#define ALERT_PIN         28U
+#define ALERT_IRQ         0
+#define ALERT_CLOCK       0
+#define ALERT_PORT_NUMBER PORTA_NUM
+GPIO_PIN_DEFINE_ACCESSORS(ALERT)
+
+#endif // __ISSDK_HAL_H__
@@ -0,0 +1,178 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host torture test of the sequence locked latest reading of sensors/p3t1085uk_latest.c.
+ *
+ * One writer thread publishes readings into a slot as fast as it can while several reader
+ * threads take snapshots of it. Publication k carries the timestamp k, the temperature
+ * (int16_t)k and a status derived from k, so a reader detects a torn read, a copy mixing
+ * fields of two publications, from the reading alone. The checks, for every snapshot:
+ *   - the three fields come from the same publication,
+ *   - the sequence is the one of that publication, 2 * k,
+ *   - the sequences seen by one reader never go backwards.
+ * SENSOR_ERROR_BUSY, a reader giving up after P3T1085_LATEST_READ_RETRIES copies, is counted
+ * and is not an error. __DMB() of host/fsl_common.h is a full fence, so the test also holds on
+ * hosts with a weaker memory model than x86-64. With a single host CPU the threads only
+ * interleave on preemption, run it on a multi-core host for real concurrency.
+ *
+ * Build and run from this directory:
+ *   E=../frdmmcxn947/frdmmcxn947_p3t1085uk_example
+ *   gcc -O2 -Wall -pthread -Ihost -I$E/interfaces -I$E/sensors -o latest_torture latest_torture.c \
+ *       $E/sensors/p3t1085uk_latest.c
+ *   ./latest_torture [--readers N] [--seconds S]
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sensor_drv.h"
+#include "p3t1085uk_latest.h"
+
+#define TEST_MAX_READERS (16U)
+#define TEST_STATUS_KEY  (0x5A5A5A5AU)
+
+typedef struct
+{
+    pthread_t thread;
+    unsigned long reads;
+    unsigned long busy;
+    unsigned long torn;
+    unsigned long backwards;
+} test_reader_t;
+
+static p3t1085_latest_t s_slot;
+static volatile bool s_stop;
+static unsigned long s_published;
+
+static int32_t StatusOf(uint32_t k)
+{
+    return (int32_t)(k ^ TEST_STATUS_KEY);
+}
+
+static void *Writer(void *pArg)
+{
+    uint32_t k = 0U;
+
+    (void)pArg;
+    while (!s_stop)
+    {
+        k++;
+        P3T1085_Latest_Publish(&s_slot, (int16_t)k, StatusOf(k), k);
+    }
+    s_published = k;
+
+    return NULL;
+}
+
+static void *Reader(void *pArg)
+{
+    test_reader_t *pReader = (test_reader_t *)pArg;
+    p3t1085_reading_t reading;
+    uint32_t lastSequence = 0U;
+    int32_t status;
+
+    while (!s_stop)
+    {
+        status = P3T1085_Latest_Read(&s_slot, &reading);
+        if (SENSOR_ERROR_BUSY == status)
+        {
+            pReader->busy++;
+            continue;
+        }
+        if (SENSOR_ERROR_INIT == status)
+        {
+            continue;
+        }
+
+        pReader->reads++;
+        if ((reading.tempQ4 != (int16_t)reading.timestamp) || (reading.status != StatusOf(reading.timestamp)) ||
+            (reading.sequence != 2U * reading.timestamp))
+        {
+            if (pReader->torn++ < 5U)
+            {
+                printf("torn read: sequence %u, timestamp %u, tempQ4 %d, status 0x%08x\n", reading.sequence,
+                       reading.timestamp, reading.tempQ4, (uint32_t)reading.status);
+            }
+        }
+        /* Unsigned difference, the sequence may wrap on a long run. */
+        if ((int32_t)(reading.sequence - lastSequence) < 0)
+        {
+            pReader->backwards++;
+        }
+        lastSequence = reading.sequence;
+    }
+
+    return NULL;
+}
+
+int main(int argc, char *argv[])
+{
+    test_reader_t readers[TEST_MAX_READERS];
+    unsigned long readerCount = 3U;
+    unsigned long seconds = 2U;
+    unsigned long reads = 0U;
+    unsigned long busy = 0U;
+    unsigned long errors = 0U;
+    pthread_t writer;
+    struct timespec duration;
+    int i;
+
+    for (i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--readers") == 0) && (i + 1 < argc))
+        {
+            readerCount = strtoul(argv[++i], NULL, 0);
+        }
+        else if ((strcmp(argv[i], "--seconds") == 0) && (i + 1 < argc))
+        {
+            seconds = strtoul(argv[++i], NULL, 0);
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [--readers N] [--seconds S]\n", argv[0]);
+            return 2;
+        }
+    }
+    if ((readerCount == 0U) || (readerCount > TEST_MAX_READERS))
+    {
+        fprintf(stderr, "--readers must be 1 to %u\n", TEST_MAX_READERS);
+        return 2;
+    }
+
+    memset(readers, 0, sizeof(readers));
+    for (unsigned long r = 0U; r < readerCount; r++)
+    {
+        pthread_create(&readers[r].thread, NULL, Reader, &readers[r]);
+    }
+    pthread_create(&writer, NULL, Writer, NULL);
+
+    duration.tv_sec = (time_t)seconds;
+    duration.tv_nsec = 0;
+    nanosleep(&duration, NULL);
+    s_stop = true;
+
+    pthread_join(writer, NULL);
+    for (unsigned long r = 0U; r < readerCount; r++)
+    {
+        pthread_join(readers[r].thread, NULL);
+        reads += readers[r].reads;
+        busy += readers[r].busy;
+        errors += readers[r].torn + readers[r].backwards;
+        if ((readers[r].torn != 0U) || (readers[r].backwards != 0U))
+        {
+            printf("reader %lu: %lu torn, %lu backwards in %lu reads\n", r, readers[r].torn, readers[r].backwards,
+                   readers[r].reads);
+        }
+    }
+
+    printf("%lu publications, %lu readers: %lu snapshots checked, %lu busy, %lu errors\n", s_published, readerCount,
+           reads, busy, errors);
+
+    return (errors == 0U) ? 0 : 1;
+}
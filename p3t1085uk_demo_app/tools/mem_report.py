@@ -0,0 +1,273 @@
+#!/usr/bin/env python3
+#
+# Copyright 2024 NXP
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+"""Static memory budget of the sensor stack, run as a post-build step.
+
+The RAM use per memory region and per object file is read from the linker map.
+The worst case stack depth of every public driver API is the deepest path of
+the call graph written by GCC with -fcallgraph-info=su (one .ci file per object),
+plus the deepest interrupt handler and the exception frame stacked on entry.
+
+    mem_report.py app.map --ci-dir Debug
+    mem_report.py app.map --ci-dir Debug --max-stack 1024 --no-heap
+
+Without --max-stack the APIs are checked against the _StackSize of the map.
+
+The exit status is 1 when a limit is exceeded, a heap function is linked with
+--no-heap, or an API stack depth cannot be bounded (recursion, unresolved call).
+Without any .ci file, from a compiler older than GCC 10, the stack check is
+skipped with a warning.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+# Public driver APIs and interrupt entries, the roots of the stack analysis.
+API_PATTERN = r"^(P3T1085_|Register_I2C_|Sensor_I2C_)"
+ISR_PATTERN = r"(_IRQHandler|_DriverIRQHandler)$"
+# CMSIS driver functions reached through ARM_DRIVER_I2C, the only indirect calls of the stack.
+INDIRECT_PATTERN = r"^([^:]+:)?LPI2C\d*_(Interrupt|Master_Interrupt|Master_Edma)"
+# Cortex-M33 exception entry with the extended (FPU) frame.
+EXCEPTION_FRAME_BYTES = 104
+
+HEAP_FUNCTIONS = re.compile(r"^\.text\.(_?malloc(_r)?|_?free(_r)?|_?calloc(_r)?|_?realloc(_r)?|_sbrk(_r)?|__sbrk)$")
+INPUT_SECTION = re.compile(r"^ (\S+)?\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$")
+REGION = re.compile(r"^(\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)(\s+\S+)?\s*$")
+RESERVED = re.compile(r"^\s+0x([0-9a-fA-F]+)\s+(_HeapSize|_StackSize)\s*=")
+CI_NODE = re.compile(r'^node: \{ title: "([^"]+)" label: "([^"]*)"')
+CI_EDGE = re.compile(r'^edge: \{ sourcename: "([^"]+)" targetname: "([^"]+)"')
+CI_BYTES = re.compile(r"\\n(\d+) bytes \((static|dynamic|dynamic,bounded)\)")
+
+UNBOUNDED = None
+
+
+def parse_map(path):
+    """Return (regions, sections, reserved) from a GNU ld map file."""
+    regions = []
+    sections = []
+    reserved = {}
+    state = None
+    pending = None
+    with open(path, errors="replace") as f:
+        for line in f:
+            line = line.rstrip("\r\n")
+            if line.startswith("Memory Configuration"):
+                state = "regions"
+                continue
+            if line.startswith("Linker script and memory map"):
+                state = "map"
+                continue
+            if state == "regions":
+                m = REGION.match(line)
+                if m and m.group(1) not in ("Name", "*default*"):
+                    regions.append((m.group(1), int(m.group(2), 16), int(m.group(3), 16)))
+            elif state == "map":
+                m = RESERVED.match(line)
+                if m:
+                    reserved[m.group(2)] = int(m.group(1), 16)
+                    continue
+                if re.match(r"^ \S+$", line):
+                    pending = line.strip()
+                    continue
+                m = INPUT_SECTION.match(line)
+                name = m and (m.group(1) or pending)
+                pending = None
+                if not m or not name or name == "*fill*":
+                    continue
+                size = int(m.group(3), 16)
+                if size:
+                    sections.append((name, int(m.group(2), 16), size, m.group(4).strip()))
+    return regions, sections, reserved
+
+
+def module_name(path):
+    """Object file of an input section, archive members as lib.a(member.o)."""
+    m = re.match(r"(.*)\((.*)\)$", path)
+    if m:
+        return "%s(%s)" % (os.path.basename(m.group(1)), m.group(2))
+    return os.path.basename(path)
+
+
+def ram_report(regions, sections, reserved, top, out):
+    ram = [r for r in regions if "FLASH" not in r[0].upper()]
+    used = {r[0]: 0 for r in ram}
+    modules = {}
+    objects = []
+    for name, addr, size, path in sections:
+        for region, origin, length in ram:
+            if origin <= addr < origin + length:
+                used[region] += size
+                key = (region, module_name(path))
+                modules[key] = modules.get(key, 0) + size
+                objects.append((size, region, name, module_name(path)))
+                break
+
+    out.write("Static RAM per region\n")
+    for region, origin, length in ram:
+        out.write("  %-12s %8d / %8d bytes (%5.1f%%)\n" % (region, used[region], length, 100.0 * used[region] / length))
+    for key in ("_HeapSize", "_StackSize"):
+        if key in reserved:
+            out.write("  %-12s %8d bytes reserved\n" % (key.strip("_"), reserved[key]))
+
+    out.write("\nStatic RAM per object file\n")
+    for (region, module), size in sorted(modules.items(), key=lambda kv: -kv[1])[:top]:
+        out.write("  %6d  %-10s %s\n" % (size, region, module))
+
+    out.write("\nLargest RAM sections\n")
+    for size, region, name, module in sorted(objects, reverse=True)[:top]:
+        out.write("  %6d  %-10s %-40s %s\n" % (size, region, name, module))
+
+
+def heap_functions(sections):
+    return sorted({name[len(".text."):] for name, _, _, _ in sections if HEAP_FUNCTIONS.match(name)})
+
+
+def parse_callgraph(ci_dir):
+    """Return (frames, calls) from every .ci file below ci_dir."""
+    frames = {}
+    calls = {}
+    for root, _, files in os.walk(ci_dir):
+        for fname in files:
+            if not fname.endswith(".ci"):
+                continue
+            with open(os.path.join(root, fname), errors="replace") as f:
+                for line in f:
+                    m = CI_NODE.match(line)
+                    if m:
+                        b = CI_BYTES.search(m.group(2))
+                        if b:
+                            frames[m.group(1)] = int(b.group(1)) if b.group(2) != "dynamic" else UNBOUNDED
+                        continue
+                    m = CI_EDGE.match(line)
+                    if m:
+                        calls.setdefault(m.group(1), set()).add(m.group(2))
+    return frames, calls
+
+
+class StackAnalysis:
+    """Worst case stack depth over the call graph, a cycle or a dynamic frame is unbounded."""
+
+    def __init__(self, frames, calls, indirect, extern_bytes):
+        self.frames = frames
+        self.calls = calls
+        self.indirect = [f for f in frames if re.search(indirect, f)]
+        self.extern_bytes = extern_bytes
+        self.depth = {}
+        self.unknown = set()
+
+    def targets(self, func):
+        for callee in self.calls.get(func, ()):
+            if callee == "__indirect_call":
+                # No candidate leaves the call, and the caller, unbounded.
+                for target in self.indirect or ["__indirect_call"]:
+                    yield target
+            else:
+                yield callee
+
+    def walk(self, func, path=()):
+        if func in self.depth:
+            return self.depth[func]
+        if func in path:
+            return UNBOUNDED
+        frame = self.frames.get(func, UNBOUNDED)
+        if frame is UNBOUNDED:
+            return UNBOUNDED
+        deepest = 0
+        for callee in self.targets(func):
+            if callee not in self.frames and callee != "__indirect_call":
+                # Library and assembly functions have no frame record.
+                self.unknown.add(callee)
+                deepest = max(deepest, self.extern_bytes)
+                continue
+            d = self.walk(callee, path + (func,))
+            if d is UNBOUNDED:
+                self.depth[func] = UNBOUNDED
+                return UNBOUNDED
+            deepest = max(deepest, d)
+        self.depth[func] = frame + deepest
+        return self.depth[func]
+
+
+def stack_report(analysis, api, isr, out):
+    """Print the depth of each root, return the API depths and the worst interrupt depth."""
+    apis = {f: analysis.walk(f) for f in sorted(analysis.frames) if re.search(api, f)}
+    isrs = {f: analysis.walk(f) for f in sorted(analysis.frames) if re.search(isr, f)}
+
+    def show(depth):
+        return "unbounded" if depth is UNBOUNDED else "%d" % depth
+
+    out.write("\nWorst case stack per public API (bytes)\n")
+    for func, depth in apis.items():
+        out.write("  %9s  %s\n" % (show(depth), func))
+    out.write("\nWorst case stack per interrupt handler (bytes)\n")
+    for func, depth in isrs.items():
+        out.write("  %9s  %s\n" % (show(depth), func))
+    if analysis.unknown:
+        out.write("\nCalls without a stack record, counted as %d bytes: %s\n" %
+                  (analysis.extern_bytes, " ".join(sorted(analysis.unknown))))
+
+    worst_isr = 0
+    for depth in isrs.values():
+        worst_isr = UNBOUNDED if depth is UNBOUNDED or worst_isr is UNBOUNDED else max(worst_isr, depth)
+    return apis, worst_isr
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("map", help="linker map file")
+    parser.add_argument("--ci-dir", help="build directory holding the .ci files of -fcallgraph-info=su")
+    parser.add_argument("--api", default=API_PATTERN, help="regular expression of the public APIs")
+    parser.add_argument("--isr", default=ISR_PATTERN, help="regular expression of the interrupt handlers")
+    parser.add_argument("--indirect", default=INDIRECT_PATTERN, help="regular expression of indirect call targets")
+    parser.add_argument("--extern-bytes", type=int, default=64, help="stack of a callee without a record")
+    parser.add_argument("--max-stack", type=int, help="fail when an API plus an interrupt needs more, "
+                        "defaults to the stack reserved by the linker script")
+    parser.add_argument("--no-heap", action="store_true", help="fail when a heap function is linked")
+    parser.add_argument("--top", type=int, default=10, help="rows of the largest objects")
+    opts = parser.parse_args()
+
+    regions, sections, reserved = parse_map(opts.map)
+    if opts.max_stack is None:
+        opts.max_stack = reserved.get("_StackSize")
+    ram_report(regions, sections, reserved, opts.top, sys.stdout)
+    failed = False
+
+    heap = heap_functions(sections)
+    if opts.no_heap:
+        if heap:
+            sys.stdout.write("\nerror: heap functions linked: %s\n" % " ".join(heap))
+            failed = True
+        elif reserved.get("_HeapSize"):
+            sys.stdout.write("\nwarning: no heap function is linked, %d bytes of heap are reserved\n" %
+                             reserved["_HeapSize"])
+
+    frames = {}
+    if opts.ci_dir:
+        frames, calls = parse_callgraph(opts.ci_dir)
+        if not frames:
+            sys.stdout.write("\nwarning: no call graph below %s, the stack check needs -fcallgraph-info=su "
+                             "(GCC 10 or later)\n" % opts.ci_dir)
+    if frames:
+        analysis = StackAnalysis(frames, calls, opts.indirect, opts.extern_bytes)
+        apis, worst_isr = stack_report(analysis, opts.api, opts.isr, sys.stdout)
+        for func, depth in apis.items():
+            if depth is UNBOUNDED:
+                sys.stdout.write("error: %s has no stack bound\n" % func)
+                failed = True
+            elif opts.max_stack is not None:
+                total = depth + EXCEPTION_FRAME_BYTES + (worst_isr or 0)
+                if worst_isr is UNBOUNDED or total > opts.max_stack:
+                    sys.stdout.write("error: %s needs %s bytes with an interrupt, over %d\n" %
+                                     (func, "unbounded" if worst_isr is UNBOUNDED else total, opts.max_stack))
+                    failed = True
+
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
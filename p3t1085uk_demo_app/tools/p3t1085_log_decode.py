@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+#
+# Copyright 2024 NXP
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+"""Decode P3T1085UK compressed sample logs on the host.
+
+The firmware keeps the history of a sensor in fixed-size blocks, each a keyframe
+followed by Rice coded zigzag differences (see sensors/p3t1085uk_log.h). This
+tool expands the blocks into one line per reading, time in milliseconds and
+temperature in Celsius.
+
+    p3t1085_log_decode.py log.bin                     (raw blocks, oldest first)
+    p3t1085_log_decode.py --hex capture.txt           (console output of "log dump")
+    p3t1085_log_decode.py --hex capture.txt --time 3600000
+    p3t1085_log_decode.py --stats log.bin
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+HEADER_SIZE = 10
+ESCAPE_Q = 8
+CODE_BITS = 12
+
+
+class BitReader:
+    """MSB-first reader over the bit stream of a block."""
+
+    def __init__(self, data):
+        self.value = int.from_bytes(data, "big")
+        self.size = len(data) * 8
+        self.pos = 0
+
+    def read(self, bits):
+        if self.pos + bits > self.size:
+            raise ValueError("code beyond the end of the block")
+        self.pos += bits
+        return (self.value >> (self.size - self.pos)) & ((1 << bits) - 1)
+
+
+def sign_extend(code):
+    return code - (1 << CODE_BITS) if code & (1 << (CODE_BITS - 1)) else code
+
+
+def decode_block(block):
+    """Return (time_ms, period_ms, [temperature in 1/16 C]) of a block."""
+    time_ms, period_ms, key, count = struct.unpack_from("<IHHH", block, 0)
+    k = key >> CODE_BITS
+    temp = sign_extend(key & ((1 << CODE_BITS) - 1))
+    temps = [temp] if count else []
+    bits = BitReader(block[HEADER_SIZE:])
+    for _ in range(1, count):
+        q = 0
+        while q < ESCAPE_Q and bits.read(1):
+            q += 1
+        if q == ESCAPE_Q:
+            temp = sign_extend(bits.read(CODE_BITS))
+        else:
+            z = (q << k) | (bits.read(k) if k else 0)
+            temp += -((z + 1) >> 1) if z & 1 else z >> 1
+        temps.append(temp)
+    return time_ms, period_ms, temps
+
+
+def read_blocks(args):
+    if args.hex:
+        with open(args.file, "r", errors="replace") as f:
+            data = b"".join(
+                bytes.fromhex(line.strip())
+                for line in f
+                if re.fullmatch(r"[0-9a-fA-F]{%d}" % (2 * args.block_size), line.strip())
+            )
+    else:
+        with open(args.file, "rb") as f:
+            data = f.read()
+    return [data[i:i + args.block_size] for i in range(0, len(data) - args.block_size + 1, args.block_size)]
+
+
+def find_block(blocks, time_ms):
+    """Index of the newest block starting at or before time_ms, times may wrap once."""
+    base = struct.unpack_from("<I", blocks[0], 0)[0]
+    offset = (time_ms - base) & 0xFFFFFFFF
+    lo, hi = 0, len(blocks) - 1
+    while lo < hi:
+        mid = (lo + hi + 1) // 2
+        if ((struct.unpack_from("<I", blocks[mid], 0)[0] - base) & 0xFFFFFFFF) <= offset:
+            lo = mid
+        else:
+            hi = mid - 1
+    return lo
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("file", help="raw blocks, or a console capture with --hex")
+    parser.add_argument("--hex", action="store_true", help="read the hex lines printed by the log dump command")
+    parser.add_argument("--block-size", type=int, default=64, help="P3T1085_LOG_BLOCK_SIZE of the firmware")
+    parser.add_argument("--time", type=lambda s: int(s, 0), help="decode only the block holding this time in ms")
+    parser.add_argument("--stats", action="store_true", help="print the compression instead of the readings")
+    args = parser.parse_args()
+
+    blocks = read_blocks(args)
+    if not blocks:
+        sys.exit("no blocks found")
+    if args.time is not None:
+        blocks = [blocks[find_block(blocks, args.time)]]
+
+    readings = 0
+    for block in blocks:
+        time_ms, period_ms, temps = decode_block(block)
+        readings += len(temps)
+        if not args.stats:
+            for i, temp in enumerate(temps):
+                print("%u,%.4f" % ((time_ms + i * period_ms) & 0xFFFFFFFF, temp / 16.0))
+
+    if args.stats:
+        size = len(blocks) * args.block_size
+        print("%d blocks, %d readings, %d bytes" % (len(blocks), readings, size))
+        if readings:
+            print("%.2f bits per reading, %.2f:1 against 16-bit readings" % (size * 8.0 / readings, readings * 2.0 / size))
+
+
+if __name__ == "__main__":
+    main()
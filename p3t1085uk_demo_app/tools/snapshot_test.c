@@ -0,0 +1,185 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host check of the configuration snapshot (sensors/p3t1085uk_snapshot.c) and of the CRC-32
+ * (sensors/p3t1085uk_crc.c) it shares with the flash log store.
+ *
+ * The register transfers of interfaces/sensor_io_i2c.c are replaced by a mock sensor which
+ * counts them. The checks:
+ *   - the CRC-32 is the IEEE 802.3 one, and continuing over a split buffer gives the same value,
+ *   - a new image is valid without sensor, a sensor is only added at the end of the list,
+ *   - the image keeps CONFIG without its alert flags,
+ *   - a warm apply writes TLOW, THIGH and CONFIG of the image in one write list, without read,
+ *     whatever the sensor holds,
+ *   - an image failing its check or the wrong sensor is refused without bus transfer,
+ *   - a failed write is reported,
+ *   - a capture reads the registers in one transfer and updates the image.
+ *
+ * Build and run from this directory:
+ *   E=../frdmmcxn947/frdmmcxn947_p3t1085uk_example
+ *   gcc -O2 -Wall -Ihost -I$E/interfaces -I$E/sensors -I$E/CMSIS_driver/Include -o snapshot_test \
+ *       snapshot_test.c $E/sensors/p3t1085uk_snapshot.c $E/sensors/p3t1085uk_crc.c
+ *   ./snapshot_test
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "p3t1085uk.h"
+#include "p3t1085uk_crc.h"
+#include "p3t1085uk_snapshot.h"
+
+#define TEST_ADDRESS        (0x48U)
+#define TEST_BUS            (2U)
+#define TEST_REGISTER_COUNT (4U)
+
+/* Mock sensor: its registers and the transfers seen. */
+static uint16_t s_registers[TEST_REGISTER_COUNT];
+static uint32_t s_writeLists;
+static uint32_t s_registerWrites;
+static uint32_t s_reads;
+static bool s_failWrite;
+
+static unsigned long s_errors;
+
+int32_t Sensor_I2C_Write16(ARM_DRIVER_I2C *pCommDrv,
+                           registerDeviceInfo_t *devInfo,
+                           uint16_t slaveAddress,
+                           const registerwritelist16_t *pRegWriteList,
+                           uint8_t bytesPerAddress)
+{
+    (void)pCommDrv;
+    (void)devInfo;
+    (void)bytesPerAddress;
+
+    s_writeLists++;
+    if (s_failWrite || (slaveAddress != TEST_ADDRESS))
+    {
+        return SENSOR_ERROR_WRITE;
+    }
+    for (; pRegWriteList->writeTo != 0xFFFFU; pRegWriteList++)
+    {
+        s_registers[pRegWriteList->writeTo] = pRegWriteList->value;
+        s_registerWrites++;
+    }
+
+    return SENSOR_ERROR_NONE;
+}
+
+int32_t Sensor_I2C_ReadCoalesced(ARM_DRIVER_I2C *pCommDrv,
+                                 registerDeviceInfo_t *devInfo,
+                                 uint16_t slaveAddress,
+                                 const registerreadlist_t *pReadList,
+                                 uint8_t bytesPerAddress,
+                                 uint8_t *pOutBuffer)
+{
+    (void)pCommDrv;
+    (void)devInfo;
+    (void)bytesPerAddress;
+
+    s_reads++;
+    if (slaveAddress != TEST_ADDRESS)
+    {
+        return SENSOR_ERROR_READ;
+    }
+    for (; pReadList->numBytes != 0U; pReadList++)
+    {
+        *pOutBuffer++ = (uint8_t)(s_registers[pReadList->readFrom] >> 8);
+        *pOutBuffer++ = (uint8_t)s_registers[pReadList->readFrom];
+    }
+
+    return SENSOR_ERROR_NONE;
+}
+
+static void Check(bool condition, const char *pWhat)
+{
+    if (!condition)
+    {
+        s_errors++;
+        printf("failed: %s\n", pWhat);
+    }
+}
+
+static void ResetBus(void)
+{
+    s_writeLists = 0U;
+    s_registerWrites = 0U;
+    s_reads = 0U;
+}
+
+int main(void)
+{
+    static const uint8_t cCheck[] = "123456789";
+    const p3t1085_config_t cConfig = {.config = 0x2028U, .tlow = 0x1A00U, .thigh = 0x1E00U};
+    p3t1085_i2c_sensorhandle_t handle;
+    p3t1085_snapshot_t snapshot;
+    uint32_t crc;
+
+    /* CRC-32: the check value of the standard, and one pass equal to two. */
+    Check(P3T1085_Crc32(0U, cCheck, 9U) == 0xCBF43926U, "CRC-32 check value");
+    crc = P3T1085_Crc32(P3T1085_Crc32(0U, cCheck, 4U), &cCheck[4], 5U);
+    Check(crc == 0xCBF43926U, "CRC-32 continued over a split buffer");
+
+    memset(&handle, 0, sizeof(handle));
+    handle.isInitialized = true;
+    handle.slaveAddress = TEST_ADDRESS;
+    handle.deviceInfo.deviceInstance = TEST_BUS;
+
+    /* A new image, then one sensor at the end of the list. */
+    P3T1085_Snapshot_Init(&snapshot, 400000U);
+    Check(P3T1085_Snapshot_IsValid(&snapshot) && (snapshot.sensorCount == 0U), "new image valid and empty");
+    Check(P3T1085_Snapshot_Set(&snapshot, 1U, &handle, &cConfig) == SENSOR_ERROR_INVALID_PARAM, "set past the end");
+    Check(P3T1085_Snapshot_Set(&snapshot, 0U, &handle, &cConfig) == SENSOR_ERROR_NONE, "set of the first sensor");
+    Check(P3T1085_Snapshot_IsValid(&snapshot) && (snapshot.sensorCount == 1U), "image valid with one sensor");
+
+    /* Warm apply: one write list of the image registers, no read, the flags and old values ignored. */
+    s_registers[P3T1085UK_CONFIG] = 0x20A8U | P3T1085UK_CONFIG_RO_MASK;
+    s_registers[P3T1085UK_TLOW] = 0x1A05U;
+    s_registers[P3T1085UK_THIGH] = 0x0000U;
+    ResetBus();
+    Check(P3T1085_Snapshot_Apply(&snapshot, 0U, &handle) == SENSOR_ERROR_NONE, "warm apply");
+    Check((s_reads == 0U) && (s_writeLists == 1U) && (s_registerWrites == P3T1085_SNAPSHOT_REG_COUNT),
+          "warm apply is one write list without read");
+    Check((s_registers[P3T1085UK_CONFIG] == cConfig.config) && (s_registers[P3T1085UK_TLOW] == cConfig.tlow) &&
+              (s_registers[P3T1085UK_THIGH] == cConfig.thigh),
+          "warm apply sets the image values");
+
+    /* Wrong sensor, bad image and failed write. */
+    handle.slaveAddress = TEST_ADDRESS + 1U;
+    ResetBus();
+    Check(P3T1085_Snapshot_Apply(&snapshot, 0U, &handle) == SENSOR_ERROR_BAD_ADDRESS, "apply to another sensor");
+    handle.slaveAddress = TEST_ADDRESS;
+    handle.deviceInfo.deviceInstance = TEST_BUS + 1U;
+    Check(P3T1085_Snapshot_Apply(&snapshot, 0U, &handle) == SENSOR_ERROR_BAD_ADDRESS, "apply on another bus");
+    handle.deviceInfo.deviceInstance = TEST_BUS;
+    Check(P3T1085_Snapshot_Apply(&snapshot, 1U, &handle) == SENSOR_ERROR_INVALID_PARAM, "apply of a missing slot");
+    Check((s_reads == 0U) && (s_writeLists == 0U), "refused applies without transfer");
+    s_failWrite = true;
+    Check(P3T1085_Snapshot_Apply(&snapshot, 0U, &handle) == SENSOR_ERROR_WRITE, "apply with a failed write");
+    s_failWrite = false;
+
+    /* Capture: one read of the registers, the alert flags dropped. */
+    s_registers[P3T1085UK_TLOW] = 0x1000U;
+    s_registers[P3T1085UK_CONFIG] = cConfig.config | P3T1085UK_CONFIG_RO_MASK;
+    ResetBus();
+    Check(P3T1085_Snapshot_Capture(&snapshot, 0U, &handle) == SENSOR_ERROR_NONE, "capture");
+    Check((s_reads == 1U) && (s_writeLists == 0U), "capture is one read");
+    Check((snapshot.sensors[0].config.tlow == 0x1000U) && (snapshot.sensors[0].config.config == cConfig.config) &&
+              P3T1085_Snapshot_IsValid(&snapshot),
+          "capture updates the image without the alert flags");
+
+    /* One flipped bit fails the check, the image is then not applied. */
+    ((uint8_t *)&snapshot.sensors[0].config)[0] ^= 1U;
+    Check(!P3T1085_Snapshot_IsValid(&snapshot), "corrupted image invalid");
+    ResetBus();
+    Check(P3T1085_Snapshot_Apply(&snapshot, 0U, &handle) == SENSOR_ERROR_INVALID_PARAM, "apply of a corrupted image");
+    Check(s_writeLists == 0U, "corrupted image not written");
+
+    printf("snapshot checks: %lu errors, image of %u bytes\n", s_errors, (uint32_t)sizeof(snapshot));
+
+    return (s_errors == 0U) ? 0 : 1;
+}
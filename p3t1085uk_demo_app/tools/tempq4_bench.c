@@ -0,0 +1,161 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host check and benchmark of the %T temperature formatter of utilities/fsl_str.c.
+ *
+ * Every 12-bit P3T1085UK code is formatted by StrFormatTempQ4() and by %T of StrFormatPrintf()
+ * at precisions 0 to 8 and checked against %f of the C library printf. The extreme values of
+ * the int32_t range are checked as well. Then the time per conversion of StrFormatPrintf("%.4T")
+ * and of the current path, StrFormatPrintf("%.4f") through ConvertFloatRadixNumToString(), is
+ * reported. On the host the double arithmetic of %f runs in hardware, on the Cortex-M33 cores it
+ * goes through the libgcc double routines, so the host ratio is a lower bound.
+ *
+ * Build and run from this directory:
+ *   gcc -O2 -Wall -Wextra -DPRINTF_FLOAT_ENABLE=1 -Ihost \
+ *       -I../frdmmcxn947/frdmmcxn947_p3t1085uk_example/utilities -o tempq4_bench tempq4_bench.c \
+ *       ../frdmmcxn947/frdmmcxn947_p3t1085uk_example/utilities/fsl_str.c -lm
+ *   ./tempq4_bench [--iterations N]
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "fsl_str.h"
+
+#define BENCH_CODE_MIN (-2048)
+#define BENCH_CODE_MAX (2047)
+#define BENCH_MAX_PRECISION (8U)
+
+static void BufferCallback(char *buf, int32_t *indicator, char val, int len)
+{
+    int i;
+
+    for (i = 0; i < len; i++)
+    {
+        buf[(*indicator)++] = val;
+    }
+}
+
+static int Format(char *pBuf, const char *pFmt, ...)
+{
+    va_list ap;
+    int length;
+
+    va_start(ap, pFmt);
+    length = StrFormatPrintf(pFmt, ap, pBuf, BufferCallback);
+    va_end(ap);
+    pBuf[length] = '\0';
+
+    return length;
+}
+
+static double Seconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+}
+
+int main(int argc, char *argv[])
+{
+    char expected[64];
+    char actual[64];
+    char sink[64];
+    unsigned long errors = 0;
+    unsigned long checks = 0;
+    unsigned long iterations = 200U;
+    double start;
+    double tempNs;
+    double floatNs;
+    const int32_t cExtremes[] = {INT32_MIN, INT32_MIN + 1, -1, 0, 1, INT32_MAX};
+    unsigned long n;
+    uint32_t p;
+    int32_t q4;
+    int i;
+
+    for (i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--iterations") == 0) && (i + 1 < argc))
+        {
+            iterations = strtoul(argv[++i], NULL, 0);
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [--iterations N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    /* Every sensor code at every precision, %T exact and round half to even like printf. */
+    for (q4 = BENCH_CODE_MIN; q4 <= BENCH_CODE_MAX; q4++)
+    {
+        for (p = 0U; p <= BENCH_MAX_PRECISION; p++)
+        {
+            snprintf(expected, sizeof(expected), "%.*f", (int)p, (double)q4 / 16.0);
+            StrFormatTempQ4(actual, q4, p);
+            checks++;
+            if (strcmp(expected, actual) != 0)
+            {
+                if (errors++ < 10U)
+                {
+                    printf("StrFormatTempQ4(%d, %u): '%s', expected '%s'\n", q4, p, actual, expected);
+                }
+            }
+            snprintf(sink, sizeof(sink), "%%.%uT", p);
+            Format(actual, sink, q4);
+            checks++;
+            if (strcmp(expected, actual) != 0)
+            {
+                if (errors++ < 10U)
+                {
+                    printf("%%.%uT of %d: '%s', expected '%s'\n", p, q4, actual, expected);
+                }
+            }
+        }
+    }
+    for (i = 0; i < (int)(sizeof(cExtremes) / sizeof(cExtremes[0])); i++)
+    {
+        snprintf(expected, sizeof(expected), "%.4f", (double)cExtremes[i] / 16.0);
+        StrFormatTempQ4(actual, cExtremes[i], 4U);
+        checks++;
+        if (strcmp(expected, actual) != 0)
+        {
+            errors++;
+            printf("StrFormatTempQ4(%d, 4): '%s', expected '%s'\n", cExtremes[i], actual, expected);
+        }
+    }
+    printf("%lu conversions checked against printf, %lu errors\n", checks, errors);
+
+    /* The same values through both printf paths of fsl_str. */
+    start = Seconds();
+    for (n = 0U; n < iterations; n++)
+    {
+        for (q4 = BENCH_CODE_MIN; q4 <= BENCH_CODE_MAX; q4++)
+        {
+            Format(sink, "%.4T", q4);
+        }
+    }
+    tempNs = (Seconds() - start) * 1e9 / ((double)iterations * (BENCH_CODE_MAX - BENCH_CODE_MIN + 1));
+
+    start = Seconds();
+    for (n = 0U; n < iterations; n++)
+    {
+        for (q4 = BENCH_CODE_MIN; q4 <= BENCH_CODE_MAX; q4++)
+        {
+            Format(sink, "%.4f", (double)q4 / 16.0);
+        }
+    }
+    floatNs = (Seconds() - start) * 1e9 / ((double)iterations * (BENCH_CODE_MAX - BENCH_CODE_MIN + 1));
+
+    printf("%%.4T %.1f ns, %%.4f %.1f ns per conversion, %.1fx\n", tempNs, floatNs, floatNs / tempNs);
+
+    return (errors == 0U) ? 0 : 1;
+}